@@ -21,6 +21,8 @@
 #include "src/utils/KeyData.hpp"
 #include "src/utils/OptionsSave.hpp"
 #include "src/utils/ResourceLoader.hpp"
+#include "src/utils/TextLayout.hpp"
+#include "src/utils/defines.hpp"
 #include "src/utils/i18n/Translator.hpp"
 #include "system/path.hpp"
 
@@ -32,13 +34,11 @@ namespace OpMon {
 
         options =
             new Utils::OptionsSave(Path::getSavePath() + "/optSave.oparams");
-        if(!options->checkParam("lang")) { // If the "lang" setting don't exist
-            options->addParam("lang", "eng");
-        }
+        options->setDefault("lang", "en");
 
         // Initializaing keys
         Utils::Log::oplog("Loading strings");
-        std::string lang = options->getParam("lang").getValue();
+        std::string lang = options->getString("lang");
         auto &tr = Utils::I18n::Translator::getInstance();
         tr.setAvailableLanguages({{"en", "keys/english.rkeys"},
                                   {"es", "keys/espanol.rkeys"},
@@ -50,6 +50,13 @@ namespace OpMon {
             lang = "en"; // The lang isn't available. Default to english.
         }
         tr.setLang(lang);
+        options->addListener("lang", [this](std::string const &name) {
+            std::string lang = options->getString(name);
+            auto &tr = Utils::I18n::Translator::getInstance();
+            if(tr.getAvailableLanguages().count(lang)) {
+                tr.setLang(lang);
+            }
+        });
 
         Utils::Log::oplog("Initializating GameData");
 
@@ -79,6 +86,11 @@ namespace OpMon {
         }
 
         Utils::ResourceLoader::load(font, "fonts/Default.ttf", true);
+        // The character sizes used by the screens. The glyphs are loaded
+        // now and each time the language changes.
+        tr.addPrewarmedFont(font, {FONT_SIZE_DEFAULT - 4, 13, 14, 15,
+                                   FONT_SIZE_DEFAULT, 18, 20, 22, 26, 30, 35,
+                                   40, 48});
 
         for(std::filesystem::directory_entry const &file :
             std::filesystem::directory_iterator(Path::getResourcePath() +
@@ -186,55 +198,42 @@ namespace OpMon {
         Utils::ResourceLoader::load(dialogArrow, "sprites/misc/arrDial.png");
 
         // Loading volume
-        if(!options->checkParam("volume")) {
-            options->addParam("volume", "100");
-        }
-
-        int volume = std::stoi(options->getParam("volume").getValue());
-        jukebox.setGlobalVolume(volume);
-
-        std::string keyUp = options->getParam("control.up").getValue();
-        if(keyUp == "NULL") {
-            options->addParam("control.up", "Up");
-            up = sf::Keyboard::Up;
-        } else {
-            up = Utils::KeyData::keysMap.at(keyUp);
-        }
-        std::string keyDown = options->getParam("control.down").getValue();
-        if(keyDown == "NULL") {
-            options->addParam("control.down", "Down");
-            down = sf::Keyboard::Down;
-        } else {
-            down = Utils::KeyData::keysMap.at(keyDown);
-        }
-        std::string keyLeft = options->getParam("control.left").getValue();
-        if(keyLeft == "NULL") {
-            options->addParam("control.left", "Left");
-            left = sf::Keyboard::Left;
-        } else {
-            left = Utils::KeyData::keysMap.at(keyLeft);
-        }
-        std::string keyRight = options->getParam("control.right").getValue();
-        if(keyRight == "NULL") {
-            options->addParam("control.right", "Right");
-            right = sf::Keyboard::Right;
-        } else {
-            right = Utils::KeyData::keysMap.at(keyRight);
-        }
-        std::string keyTalk = options->getParam("control.talk").getValue();
-        if(keyTalk == "NULL") {
-            options->addParam("control.talk", "Space");
-            talk = sf::Keyboard::Space;
-        } else {
-            talk = Utils::KeyData::keysMap.at(keyTalk);
-        }
-        std::string keyInteract =
-            options->getParam("control.interact").getValue();
-        if(keyInteract == "NULL") {
-            options->addParam("control.interact", "Return");
-            interact = sf::Keyboard::Return;
-        } else {
-            interact = Utils::KeyData::keysMap.at(keyInteract);
+        options->setDefault("volume", 100);
+        jukebox.setGlobalVolume(options->getInt("volume"));
+        options->addListener("volume", [this](std::string const &name) {
+            jukebox.setGlobalVolume(options->getInt(name, 100));
+        });
+
+        // Loading the controls, which are updated when they are changed in
+        // the options
+        struct Control {
+            std::string option;
+            sf::Keyboard::Key *key;
+            std::string defaultKey;
+        };
+        Control const controls[] = {{"control.up", &up, "Up"},
+                                    {"control.down", &down, "Down"},
+                                    {"control.left", &left, "Left"},
+                                    {"control.right", &right, "Right"},
+                                    {"control.talk", &talk, "Space"},
+                                    {"control.interact", &interact, "Return"}};
+        auto const &keys = Utils::KeyData::keysMap;
+        for(Control const &control : controls) {
+            auto found = keys.find(options->getString(control.option));
+            if(found == keys.end()) {
+                options->set(control.option, control.defaultKey);
+                found = keys.find(control.defaultKey);
+            }
+            *control.key = found->second;
+            sf::Keyboard::Key *key = control.key;
+            options->addListener(
+                control.option, [this, key](std::string const &name) {
+                    auto const &keys = Utils::KeyData::keysMap;
+                    auto found = keys.find(options->getString(name));
+                    if(found != keys.end()) {
+                        *key = found->second;
+                    }
+                });
         }
     }
 
@@ -243,6 +242,8 @@ namespace OpMon {
             delete(spe.second);
         }
         delete(options);
+        Utils::I18n::Translator::getInstance().removePrewarmedFont(font);
+        Utils::TextLayout::release(font);
         Utils::Log::oplog("Deleted GameData");
     }
 } // namespace OpMon
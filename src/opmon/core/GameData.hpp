@@ -80,6 +80,10 @@ namespace OpMon {
          * \brief Gets a pointer to a Species object.
          */
         Species *getOp(unsigned int id) { return listOp.at(id); }
+        /*!
+         * \brief Checks if a species exists, before calling getOp().
+         */
+        bool hasOp(unsigned int id) const { return listOp.count(id) != 0; }
         /*!
          * \brief Gets the texture of a type.
          */
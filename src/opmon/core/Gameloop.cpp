@@ -6,6 +6,7 @@ File under GNU GPL v3.0 license
 */
 #include "Gameloop.hpp"
 
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Sprite.hpp>
@@ -13,17 +14,28 @@ File under GNU GPL v3.0 license
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Window/Event.hpp>
 #include <algorithm>
+#include <chrono>
 #include <functional>
+#include <future>
+#include <string>
 #include <utility>
 
 #include "../../utils/StringKeys.hpp"
 #include "../screens/mainmenu/MainMenuCtrl.hpp"
 #include "src/opmon/core/GameData.hpp"
 #include "src/opmon/core/GameStatus.hpp"
+#include "src/opmon/core/SaveGame.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/opmon/view/ui/MetricsOverlay.hpp"
 #include "src/opmon/view/ui/Window.hpp"
+#include "src/utils/FrameMetrics.hpp"
+#include "src/utils/LoadingProgress.hpp"
+#include "src/utils/Profiler.hpp"
 #include "src/utils/ResourceLoader.hpp"
 #include "src/utils/exceptions.hpp"
+#include "src/utils/log.hpp"
+#include "src/utils/time.hpp"
+#include "system/path.hpp"
 
 namespace OpMon {
 
@@ -48,9 +60,10 @@ namespace OpMon {
         loadingTxt.setFont(gamedata->getFont());
         loadingTxt.setCharacterSize(35);
 
-        window->getFrame().clear(sf::Color(74, 81, 148));
-        window->getFrame().draw(loadingTxt);
-        window->refresh();
+        _drawLoadingScreen(*window, loadingTxt, 0);
+
+        Utils::FrameMetrics &metrics = Utils::FrameMetrics::getInstance();
+        Ui::MetricsOverlay metricsOverlay(gamedata->getFont());
 
         GameStatus status {GameStatus::CONTINUE};
 
@@ -59,60 +72,100 @@ namespace OpMon {
                 status = GameStatus::CONTINUE;
 
                 // Debug frame by frame
-                while(
-                    sf::Keyboard::isKeyPressed(sf::Keyboard::F2) &&
-                    !(sf::Keyboard::isKeyPressed(fbfType) && hasBeenReleased)) {
-                    if(!sf::Keyboard::isKeyPressed(fbfType)) {
-                        hasBeenReleased = true;
+                bool wasPaused = paused;
+                if(paused) {
+                    status = _waitWhilePaused(*window, metricsOverlay);
+                    if(status == GameStatus::STOP) {
+                        break;
                     }
                 }
-                hasBeenReleased = false;
+                // A paused game only advances by whole frames, so that
+                // the time spent in the pause isn't seen by the game.
+                int now = Utils::Time::getElapsedMilliseconds();
+                int tickDuration =
+                    wasPaused ? 1000 / Ui::Window::FRAMERATE : now - lastTick;
+                lastTick = now;
+                unsigned int ticks = paused ? 1 : speed;
+
+                metrics.beginFrame();
+                OPMON_PROFILE_FRAME();
+                OPMON_PROFILE_ZONE("frame");
 
                 // Gets the current game screen's controller
                 auto *ctrl = _gameScreens.top().get();
                 sf::Event event;
+                bool hadEvent = false;
 
                 // process all pending SFML events
-                while(status == GameStatus::CONTINUE) {
-                    bool isEvent = window->getWindow().pollEvent(event);
-                    if(isEvent == false)
-                        event.type = sf::Event::SensorChanged;
-                    _checkWindowResize(event, *window);
-                    status = _checkQuit(event);
-                    if(status == GameStatus::STOP ||
-                       status == GameStatus::REBOOT)
-                        break;
-                    status = ctrl->checkEvent(event);
-                    if(isEvent == false) {
-                        break;
+                {
+                    Utils::FrameMetrics::Scope eventsScope(
+                        Utils::FrameMetrics::EVENTS);
+                    OPMON_PROFILE_ZONE("events");
+                    while(status == GameStatus::CONTINUE) {
+                        bool isEvent = window->getWindow().pollEvent(event);
+                        if(isEvent == false) {
+                            event.type = sf::Event::SensorChanged;
+                        } else {
+                            hadEvent = true;
+                            metrics.addCount(Utils::FrameMetrics::EVENT_COUNT);
+                            _checkDebugKeys(event, metricsOverlay);
+                        }
+                        _checkWindowResize(event, *window);
+                        status = _checkQuit(event);
+                        if(status == GameStatus::STOP ||
+                           status == GameStatus::REBOOT)
+                            break;
+                        status = ctrl->checkEvent(event);
+                        if(isEvent == false) {
+                            break;
+                        }
                     }
                 }
 
                 if(status == GameStatus::WIN_REBOOT) {
                     window->reboot(gamedata->getOptions());
                     status = GameStatus::CONTINUE;
+                    redrawNeeded = true;
                 }
 
-                if(status == GameStatus::CONTINUE) {
-                    // frame update & draw
-                    status = ctrl->update(window->getFrame());
+                // A static screen is only updated and drawn after an event,
+                // or after idleTimeout as a safety net.
+                bool idle = status == GameStatus::CONTINUE && !hadEvent &&
+                            !redrawNeeded && !ctrl->isDirty() &&
+                            !metricsOverlay.isVisible() &&
+                            Utils::Time::getElapsedMilliseconds() - lastDraw <
+                                idleTimeout;
+
+                if(status == GameStatus::CONTINUE && !idle) {
+                    // frame update & draw, several times if fast-forwarded
+                    Utils::FrameMetrics::Scope updateScope(
+                        Utils::FrameMetrics::UPDATE);
+                    OPMON_PROFILE_ZONE("update");
+                    for(unsigned int i = 0;
+                        i < ticks && status == GameStatus::CONTINUE; i++) {
+                        Utils::Time::advanceGameTime(tickDuration);
+                        status = ctrl->update(window->getFrame());
+                    }
+                    lastDraw = Utils::Time::getElapsedMilliseconds();
+                    redrawNeeded = false;
+                } else if(idle) {
+                    Utils::Time::advanceGameTime(tickDuration * ticks);
                 }
 
                 if(status == GameStatus::NEXT ||
                    status == GameStatus::PREVIOUS ||
                    status == GameStatus::NEXT_NLS ||
                    status == GameStatus::PREVIOUS_NLS) {
-                    if(status == GameStatus::NEXT) {
-                        window->getFrame().clear(sf::Color(74, 81, 148));
-                        window->getFrame().draw(loadingTxt);
-                        window->refresh();
-                    } else {
+                    bool showLoading = status == GameStatus::NEXT;
+                    if(status == GameStatus::NEXT_NLS ||
+                       status == GameStatus::PREVIOUS_NLS) {
                         status = ((status == GameStatus::NEXT_NLS) ?
                                       GameStatus::NEXT :
                                       GameStatus::PREVIOUS);
                     }
                     if(status == GameStatus::NEXT) {
-                        ctrl->loadNextScreen();
+                        status = _loadNextScreen(*ctrl, *window, loadingTxt,
+                                                 showLoading);
                     }
                 }
 
@@ -121,18 +174,34 @@ namespace OpMon {
                                            // passes to the next
                         ctrl->suspend();
                         _gameScreens.push(ctrl->getNextGameScreen());
+                        redrawNeeded = true;
                         break;
                     case GameStatus::PREVIOUS: // Deletes the current screen and
                                                // returns to the previous one
                         _gameScreens.pop();
                         _gameScreens.top()->resume();
+                        redrawNeeded = true;
                         break;
-                    case GameStatus::CONTINUE:
-                        window->refresh();
+                    case GameStatus::CONTINUE: {
+                        if(idle) {
+                            // Nothing changed: waits for the next frame
+                            // instead of presenting the same image again.
+                            window->idle();
+                            break;
+                        }
+                        metricsOverlay.update();
+                        Utils::FrameMetrics::Scope refreshScope(
+                            Utils::FrameMetrics::REFRESH);
+                        OPMON_PROFILE_ZONE("refresh");
+                        // Drawn on the window only, so that the snapshots
+                        // taken from the frame don't contain it
+                        window->refresh(&metricsOverlay);
                         break;
+                    }
                     default:
                         break;
                 }
+                metrics.endFrame();
             } catch(Utils::Exception &e) {
                 frameskips++;
                 Utils::Log::oplog(e.desc(), true);
@@ -148,11 +217,115 @@ namespace OpMon {
             }
         }
 
+        metrics.exportJson(Path::getLogPath() + "metrics.json");
+        metrics.exportCsv(Path::getLogPath() + "metrics.csv");
+        SaveGame::getInstance().flush();
+
         delete(gamedata);
         delete(window.release());
         return status;
     }
 
+    GameStatus GameLoop::_loadNextScreen(AGameScreen &ctrl,
+                                         Ui::Window &window,
+                                         sf::Text &loadingTxt,
+                                         bool showLoading) {
+        OPMON_PROFILE_ZONE("loadNextScreen");
+        Utils::LoadingProgress progress;
+        if(!showLoading) {
+            ctrl.prepareNextScreen(progress);
+            ctrl.loadNextScreen();
+            Utils::ResourceLoader::discardPreloadedImages();
+            return GameStatus::NEXT;
+        }
+
+        std::future<void> preparation =
+            std::async(std::launch::async, [&ctrl, &progress] {
+                OPMON_PROFILE_ZONE("prepareNextScreen");
+                ctrl.prepareNextScreen(progress);
+            });
+        // The window keeps responding while the worker prepares the screen.
+        // refresh() waits for the framerate limit, so this loop doesn't spin.
+        bool closed = false;
+        sf::String loadingString = loadingTxt.getString();
+        while(preparation.wait_for(std::chrono::seconds(0)) !=
+              std::future_status::ready) {
+            sf::Event event;
+            while(window.getWindow().pollEvent(event)) {
+                _checkWindowResize(event, window);
+                closed = closed || _checkQuit(event) == GameStatus::STOP;
+            }
+            int dots = (Utils::Time::getElapsedMilliseconds() / 300) % 4;
+            loadingTxt.setString(loadingString + std::string(dots, '.'));
+            _drawLoadingScreen(window, loadingTxt, progress.getRatio());
+        }
+        loadingTxt.setString(loadingString);
+        // Throws in the main thread the exceptions thrown in the worker
+        preparation.get();
+        if(closed) {
+            return GameStatus::STOP;
+        }
+
+        _drawLoadingScreen(window, loadingTxt, 1);
+        ctrl.loadNextScreen();
+        // The images preloaded for older screens won't be used anymore
+        Utils::ResourceLoader::discardPreloadedImages();
+        return GameStatus::NEXT;
+    }
+
+    void GameLoop::_drawLoadingScreen(Ui::Window &window, sf::Text &loadingTxt,
+                                      float progress) const {
+        sf::RenderTexture &frame = window.getFrame();
+        frame.clear(sf::Color(74, 81, 148));
+        frame.draw(loadingTxt);
+        sf::RectangleShape bar(sf::Vector2f(460 * progress, 8));
+        bar.setPosition(250, 490);
+        bar.setFillColor(sf::Color::White);
+        frame.draw(bar);
+        window.refresh();
+    }
+
+    void GameLoop::_checkDebugKeys(const sf::Event &event,
+                                   Ui::MetricsOverlay &overlay) {
+        if(event.type != sf::Event::KeyPressed) {
+            return;
+        }
+        if(event.key.code == metricsKey) {
+            overlay.toggle();
+        } else if(event.key.code == profilerKey) {
+            Utils::Profiler::dump(Path::getLogPath() + "trace.json");
+        } else if(event.key.code == pauseKey) {
+            paused = !paused;
+            Utils::Log::log(Utils::Log::Level::INFO, "GameLoop",
+                            paused ? "Game paused" : "Game resumed");
+        } else if(event.key.code == fastForwardKey) {
+            speed = (speed >= MAX_SPEED) ? 1 : speed * 2;
+            Utils::Log::log(Utils::Log::Level::INFO, "GameLoop",
+                            "Game speed: x" + std::to_string(speed));
+        }
+    }
+
+    GameStatus GameLoop::_waitWhilePaused(Ui::Window &window,
+                                          Ui::MetricsOverlay &overlay) {
+        sf::Event event;
+        // waitEvent() sleeps until an event arrives
+        while(paused && window.getWindow().waitEvent(event)) {
+            if(_checkQuit(event) == GameStatus::STOP) {
+                return GameStatus::STOP;
+            }
+            if(event.type == sf::Event::Resized) {
+                _checkWindowResize(event, window);
+                window.refresh(&overlay);
+            }
+            if(event.type == sf::Event::KeyPressed &&
+               event.key.code == stepKey) {
+                break;
+            }
+            _checkDebugKeys(event, overlay);
+        }
+        return GameStatus::CONTINUE;
+    }
+
     GameStatus GameLoop::_checkQuit(const sf::Event &event) {
         if(event.type == sf::Event::Closed ||
            sf::Keyboard::isKeyPressed(sf::Keyboard::Escape)) {
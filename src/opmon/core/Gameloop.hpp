@@ -24,11 +24,13 @@
 
 namespace sf {
     class Event;
+    class Text;
 } // namespace sf
 
 namespace OpMon {
     namespace Ui {
         class Window;
+        class MetricsOverlay;
     } // namespace Ui
 
     /*!
@@ -62,6 +64,38 @@ namespace OpMon {
                                 Ui::Window &window) const;
 
       private:
+        /*!
+         * \brief Handles the debugging keys: metrics overlay, profiler and time control.
+         * \param event The native SFML event
+         * \param overlay The metrics overlay to toggle
+         */
+        void _checkDebugKeys(const sf::Event &event,
+                             Ui::MetricsOverlay &overlay);
+
+        /*!
+         * \brief Loads the next screen of `ctrl`.
+         * \details AGameScreen::prepareNextScreen() runs in a worker thread while the main thread keeps processing the window events and animating the loading screen, then AGameScreen::loadNextScreen() is called in the main thread.
+         * \param showLoading If `false`, no loading screen is shown and both steps run in the main thread.
+         * \return GameStatus::STOP if the game has been closed during the loading, GameStatus::NEXT otherwise.
+         */
+        GameStatus _loadNextScreen(AGameScreen &ctrl, Ui::Window &window,
+                                   sf::Text &loadingTxt, bool showLoading);
+
+        /*!
+         * \brief Draws the loading screen and its progress bar on the window.
+         * \param progress The progress of the loading, between 0 and 1.
+         */
+        void _drawLoadingScreen(Ui::Window &window, sf::Text &loadingTxt,
+                                float progress) const;
+
+        /*!
+         * \brief Blocks on the window events while the game is paused.
+         * \details Returns when the game is resumed or when one frame must be passed. The events received during the pause are not given to the game screen.
+         * \return GameStatus::STOP if the game is closed during the pause, GameStatus::CONTINUE otherwise.
+         */
+        GameStatus _waitWhilePaused(Ui::Window &window,
+                                    Ui::MetricsOverlay &overlay);
+
         /*!
          * \brief The pointer containing the GameData object shared in the different data objects.
          */
@@ -72,17 +106,52 @@ namespace OpMon {
         std::stack<std::unique_ptr<AGameScreen>> _gameScreens;
         /*!
          * \brief If `true`, the game executes itself frame by frame.
-         * \details This mode is activated my keeping the F2 key pressed. On release, the mode is disabled. One frame can be passed by pressing the key registered in `fbfType`.
+         * \details This mode is toggled by pressing `pauseKey`. While it's enabled, the game waits for the window events without updating the screen or advancing the game time, and one frame can be passed by pressing `stepKey`.
+         */
+        bool paused = false;
+        /*!
+         * \brief The key pausing or resuming the game.
+         */
+        sf::Keyboard::Key pauseKey = sf::Keyboard::F2;
+        /*!
+         * \brief The key to press in pause to pass one frame.
+         */
+        sf::Keyboard::Key stepKey = sf::Keyboard::F3;
+        /*!
+         * \brief The key changing the speed of the game.
+         */
+        sf::Keyboard::Key fastForwardKey = sf::Keyboard::F6;
+        /*!
+         * \brief The number of updates of the game screen per frame.
+         * \details Each press on `fastForwardKey` doubles it, up to `MAX_SPEED`, then goes back to 1.
+         */
+        unsigned int speed = 1;
+        static const unsigned int MAX_SPEED = 8;
+        /*!
+         * \brief The time of the beginning of the last frame, in milliseconds. Used to advance the game time (see Utils::Time::getGameMilliseconds()).
+         */
+        int lastTick = 0;
+        /*!
+         * \brief The key showing or hiding the frame metrics overlay.
+         */
+        sf::Keyboard::Key metricsKey = sf::Keyboard::F4;
+        /*!
+         * \brief The key writing the profiler trace of the last frames (see Utils::Profiler).
+         */
+        sf::Keyboard::Key profilerKey = sf::Keyboard::F5;
+        /*!
+         * \brief If `true`, the current screen is drawn in the next frame even if it isn't dirty (see AGameScreen::isDirty()).
+         * \details Set when the screen on the top of the stack changes or when the window is recreated.
          */
-        bool frameByFrame = false;
+        bool redrawNeeded = true;
         /*!
-         * \brief The key to press in frame by frame mode to pass one frame.
+         * \brief The time of the last draw of a screen, in milliseconds.
          */
-        sf::Keyboard::Key fbfType = sf::Keyboard::F3;
+        int lastDraw = 0;
         /*!
-         * \brief Checks in the `fbfType` key has been released before passing one more frame.
+         * \brief The maximum time without drawing a static screen, in milliseconds.
          */
-        bool hasBeenReleased = true;
+        int idleTimeout = 500;
         /*!
          * \brief Counts the number of times a frame has been skipped because of an exception.
          */
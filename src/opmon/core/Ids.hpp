@@ -0,0 +1,29 @@
+/*!
+ * \file Ids.hpp
+ * \brief The handles used to identify the game resources.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ * \details The data files refer to the resources with strings. These strings are converted to the handles below when the data is loaded, and only the handles are used after that.
+ */
+#pragma once
+
+#include "src/utils/Id.hpp"
+
+namespace OpMon {
+    /*! \brief Identifies a music of the Jukebox. */
+    using MusicId = Utils::Id<struct MusicTag>;
+    /*! \brief Identifies a sound of the Jukebox. */
+    using SoundId = Utils::Id<struct SoundTag>;
+    /*! \brief Identifies a map of the overworld. */
+    using MapId = Utils::Id<struct MapTag>;
+    /*! \brief Identifies a tileset. */
+    using TilesetId = Utils::Id<struct TilesetTag>;
+    /*! \brief Identifies an animated map element. */
+    using ElementId = Utils::Id<struct ElementTag>;
+    /*! \brief Identifies a texture used by the events. */
+    using EventTextureId = Utils::Id<struct EventTextureTag>;
+    /*! \brief Identifies an item. */
+    using ItemId = Utils::Id<struct ItemTag>;
+    /*! \brief Identifies a move definition. */
+    using MoveId = Utils::Id<struct MoveTag>;
+} // namespace OpMon
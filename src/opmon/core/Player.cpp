@@ -11,6 +11,7 @@
 #include "src/opmon/model/OpMon.hpp"
 #include "src/opmon/model/OpTeam.hpp"
 #include "src/opmon/view/elements/Position.hpp"
+#include "src/utils/log.hpp"
 #include "src/utils/misc.hpp"
 
 namespace OpMon {
@@ -25,13 +26,24 @@ namespace OpMon {
 
     OpTeam *Player::getOpTeam() { return &opteam; }
 
-    void Player::addItem(std::string const &itemID) { bag[itemID]++; }
+    void Player::addItem(ItemId itemID) {
+        if(!itemID.isValid()) {
+            Utils::Log::warn("Trying to add an unknown item to the bag.");
+            return;
+        }
+        if(itemID.getIndex() >= bag.size()) {
+            bag.resize(ItemId::count(), 0);
+        }
+        bag[itemID.getIndex()]++;
+    }
 
-    int Player::checkItem(std::string const &itemID) { return bag[itemID]; }
+    int Player::checkItem(ItemId itemID) {
+        return itemID.getIndex() < bag.size() ? bag[itemID.getIndex()] : 0;
+    }
 
-    bool Player::deleteItem(std::string const &itemID) {
-        if(bag[itemID] != 0) {
-            bag[itemID]--;
+    bool Player::deleteItem(ItemId itemID) {
+        if(checkItem(itemID) != 0) {
+            bag[itemID.getIndex()]--;
             return true;
         } else {
             return false;
@@ -44,16 +56,35 @@ namespace OpMon {
             OpMon *pkmn = opteam[i];
             if(pkmn != nullptr) {
                 // TODO : Reset status problems
-                for(int j = 0; j < 4; j++) {
-                    Move *atk = (pkmn->getMoves())[j];
-                    if(atk != nullptr) {
-                        atk->healPP();
+                for(Move &atk : pkmn->getMoves()) {
+                    if(!atk.isEmpty()) {
+                        atk.healPP();
                     }
                 }
             }
         }
     }
 
+    void Player::setItemCount(ItemId itemID, int count) {
+        if(!itemID.isValid()) {
+            Utils::Log::warn("Trying to add an unknown item to the bag.");
+            return;
+        }
+        if(itemID.getIndex() >= bag.size()) {
+            bag.resize(ItemId::count(), 0);
+        }
+        bag[itemID.getIndex()] = count;
+    }
+
+    void Player::clear() {
+        opteam.clear();
+        for(OpMon *op : pc) {
+            delete(op);
+        }
+        pc.clear();
+        bag.clear();
+    }
+
     bool Player::addOpToOpTeam(OpMon *toAdd) {
         if(opteam.addOpMon(toAdd)) {
             return true;
@@ -12,11 +12,12 @@
 
 #include <SFML/System.hpp>
 #include <algorithm>
-#include <map>
+#include <vector>
 
 #include "../model/Item.hpp"
 #include "../model/OpTeam.hpp"
 #include "../view/elements/Position.hpp"
+#include "Ids.hpp"
 
 namespace OpMon {
 
@@ -39,17 +40,17 @@ namespace OpMon {
         /*!
          * \warning Work in progress.
          */
-        void addItem(std::string const &itemID);
+        void addItem(ItemId itemID);
 
         /*!
          * \warning Work in progress.
          */
-        int checkItem(std::string const &itemID);
+        int checkItem(ItemId itemID);
 
         /*!
          * \warning Work in progress.
          */
-        bool deleteItem(std::string const &itemID);
+        bool deleteItem(ItemId itemID);
 
         sf::String getName() const { return name; }
 
@@ -95,11 +96,32 @@ namespace OpMon {
 
         bool isKo() { return opteam.isKo(); }
 
+        /*!
+         * \brief Returns the content of the bag: the number of each item, indexed by ItemId.
+         */
+        std::vector<int> const &getBag() const { return bag; }
+
+        /*!
+         * \brief Sets the number of an item in the bag.
+         */
+        void setItemCount(ItemId itemID, int count);
+
+        /*!
+         * \brief Returns the OpMon in the computer.
+         */
+        std::vector<OpMon *> const &getPc() const { return pc; }
+
+        /*!
+         * \brief Deletes all the OpMon of the team and of the computer, and empties the bag.
+         * \details Used before restoring a save.
+         */
+        void clear();
+
       private:
         sf::String name;
         const unsigned int
             trainerID; // Max : 8 digits in hexadecimal (Unimplemented yet)
-        std::map<std::string, int> bag;
+        std::vector<int> bag;
         std::vector<OpMon *> pc = std::vector<OpMon *>();
         OpTeam opteam;
     };
@@ -0,0 +1,484 @@
+/*
+SaveGame.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "SaveGame.hpp"
+
+#include <SFML/System/String.hpp>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "GameData.hpp"
+#include "Player.hpp"
+#include "src/opmon/model/OpMon.hpp"
+#include "src/opmon/model/OpTeam.hpp"
+#include "src/opmon/screens/overworld/OverworldData.hpp"
+#include "src/utils/Compression.hpp"
+#include "src/utils/exceptions.hpp"
+#include "src/utils/fs.hpp"
+#include "src/utils/log.hpp"
+
+namespace OpMon {
+
+    namespace {
+        const char MAGIC[4] = {'O', 'P', 'M', 'S'};
+        constexpr std::size_t HEADER_SIZE = 16;
+
+        std::uint32_t checksum(std::vector<std::uint8_t> const &data) {
+            std::uint32_t hash = 2166136261u;
+            for(std::uint8_t byte : data) {
+                hash = (hash ^ byte) * 16777619u;
+            }
+            return hash;
+        }
+
+        std::string toUtf8(sf::String const &string) {
+            auto utf8 = string.toUtf8();
+            return std::string(utf8.begin(), utf8.end());
+        }
+
+        sf::String fromUtf8(std::string const &string) {
+            return sf::String::fromUtf8(string.begin(), string.end());
+        }
+
+        /*!
+         * \brief Appends little-endian values to a buffer.
+         */
+        class Writer {
+          public:
+            explicit Writer(std::vector<std::uint8_t> &out): out(out) {}
+
+            void u32(std::uint32_t value) {
+                for(int i = 0; i < 4; i++) {
+                    out.push_back((value >> (8 * i)) & 0xFF);
+                }
+            }
+            void i32(std::int32_t value) { u32(value); }
+            void str(std::string const &value) {
+                u32(value.size());
+                out.insert(out.end(), value.begin(), value.end());
+            }
+            void bytes(std::vector<std::uint8_t> const &value) {
+                u32(value.size());
+                out.insert(out.end(), value.begin(), value.end());
+            }
+
+          private:
+            std::vector<std::uint8_t> &out;
+        };
+
+        /*!
+         * \brief Reads the values written by Writer.
+         * \details Reading past the end of the data returns zeros and sets `failed`, so the data is only checked once at the end.
+         */
+        class Reader {
+          public:
+            explicit Reader(std::vector<std::uint8_t> const &data)
+                : data(data) {}
+
+            bool failed = false;
+
+            std::uint32_t u32() {
+                if(!has(4)) {
+                    return 0;
+                }
+                std::uint32_t value = 0;
+                for(int i = 0; i < 4; i++) {
+                    value |= std::uint32_t(data[pos++]) << (8 * i);
+                }
+                return value;
+            }
+            std::int32_t i32() { return u32(); }
+            std::string str() {
+                std::uint32_t size = u32();
+                if(!has(size)) {
+                    return "";
+                }
+                pos += size;
+                return std::string(data.begin() + pos - size,
+                                   data.begin() + pos);
+            }
+            std::vector<std::uint8_t> bytes() {
+                std::uint32_t size = u32();
+                if(!has(size)) {
+                    return {};
+                }
+                pos += size;
+                return std::vector<std::uint8_t>(data.begin() + pos - size,
+                                                 data.begin() + pos);
+            }
+            /*!
+             * \brief Reads a number of elements, checking that they can fit in the remaining data.
+             */
+            std::uint32_t count(std::size_t minElementSize) {
+                std::uint32_t value = u32();
+                if(value > (data.size() - pos) / minElementSize) {
+                    failed = true;
+                    return 0;
+                }
+                return value;
+            }
+            bool atEnd() const { return pos == data.size(); }
+
+          private:
+            bool has(std::size_t size) {
+                if(failed || data.size() - pos < size) {
+                    failed = true;
+                    return false;
+                }
+                return true;
+            }
+
+            std::vector<std::uint8_t> const &data;
+            std::size_t pos = 0;
+        };
+
+        SaveGame::OpMonState captureOpMon(OpMon &opmon) {
+            SaveGame::OpMonState state;
+            OpMon::Individual individual = opmon.getIndividual();
+            state.species = opmon.getSpecies().getOpdexNumber();
+            state.nickname = toUtf8(opmon.getNickname());
+            state.level = opmon.getLevel();
+            state.nature = (unsigned int)opmon.getNature();
+            state.hp = individual.hp;
+            state.status = (int)individual.status;
+            state.exp = individual.exp;
+            state.ivs = individual.ivs;
+            state.evs = individual.evs;
+            for(unsigned int i = 0; i < state.moves.size(); i++) {
+                Move const &move = opmon.getMoves()[i];
+                if(!move.isEmpty()) {
+                    state.moves[i] = move.getId().getName();
+                    state.pp[i] = move.getPP();
+                }
+            }
+            return state;
+        }
+
+        OpMon *createOpMon(SaveGame::OpMonState const &state,
+                           GameData &gamedata) {
+            std::array<Move, 4> moves;
+            for(unsigned int i = 0; i < moves.size(); i++) {
+                if(!state.moves[i].empty()) {
+                    moves[i] = Move(state.moves[i]);
+                    moves[i].setPP(state.pp[i]);
+                }
+            }
+            OpMon *opmon = new OpMon("", gamedata.getOp(state.species),
+                                     state.level, moves, (Nature)state.nature);
+            opmon->getNicknameRef() = fromUtf8(state.nickname);
+            opmon->setIndividual({state.ivs, state.evs, state.exp, state.hp,
+                                  (Status)state.status});
+            return opmon;
+        }
+
+        void writeOpMon(Writer &writer, SaveGame::OpMonState const &state) {
+            writer.u32(state.species);
+            writer.str(state.nickname);
+            writer.i32(state.level);
+            writer.u32(state.nature);
+            writer.i32(state.hp);
+            writer.i32(state.status);
+            writer.i32(state.exp);
+            for(int value : state.ivs) {
+                writer.i32(value);
+            }
+            for(int value : state.evs) {
+                writer.i32(value);
+            }
+            for(unsigned int i = 0; i < state.moves.size(); i++) {
+                writer.str(state.moves[i]);
+                writer.i32(state.pp[i]);
+            }
+        }
+
+        SaveGame::OpMonState readOpMon(Reader &reader) {
+            SaveGame::OpMonState state;
+            state.species = reader.u32();
+            state.nickname = reader.str();
+            state.level = reader.i32();
+            state.nature = reader.u32();
+            state.hp = reader.i32();
+            state.status = reader.i32();
+            state.exp = reader.i32();
+            for(int &value : state.ivs) {
+                value = reader.i32();
+            }
+            for(int &value : state.evs) {
+                value = reader.i32();
+            }
+            for(unsigned int i = 0; i < state.moves.size(); i++) {
+                state.moves[i] = reader.str();
+                state.pp[i] = reader.i32();
+            }
+            // The enums are cast from these values when the save is applied
+            if(state.nature > (unsigned int)Nature::TIMID ||
+               state.status < 0 || state.status > (int)Status::NOTHING) {
+                reader.failed = true;
+            }
+            return state;
+        }
+
+        std::vector<std::uint8_t> serialize(SaveGame::State const &state) {
+            std::vector<std::uint8_t> data;
+            Writer writer(data);
+            writer.str(state.playerName);
+            writer.u32(state.bag.size());
+            for(auto const &[item, count] : state.bag) {
+                writer.str(item);
+                writer.i32(count);
+            }
+            for(auto const *opmons : {&state.team, &state.pc}) {
+                writer.u32(opmons->size());
+                for(SaveGame::OpMonState const &opmon : *opmons) {
+                    writeOpMon(writer, opmon);
+                }
+            }
+            writer.str(state.map);
+            writer.i32(state.positionX);
+            writer.i32(state.positionY);
+            writer.u32(state.events.size());
+            for(auto const &[map, events] : state.events) {
+                writer.str(map);
+                writer.bytes(events);
+            }
+            return data;
+        }
+
+        /*!
+         * \brief Reads the data of a save.
+         * \details The fields added by a version of the format must only be read if `version` is at least this version.
+         * \returns `false` if the data is corrupted.
+         */
+        bool deserialize(std::vector<std::uint8_t> const &data,
+                         std::uint32_t version, SaveGame::State &state) {
+            Reader reader(data);
+            state.version = version;
+            state.playerName = reader.str();
+            for(std::uint32_t i = reader.count(8); i > 0; i--) {
+                std::string item = reader.str();
+                state.bag[item] = reader.i32();
+            }
+            for(auto *opmons : {&state.team, &state.pc}) {
+                for(std::uint32_t i = reader.count(96); i > 0; i--) {
+                    opmons->push_back(readOpMon(reader));
+                }
+            }
+            state.map = reader.str();
+            state.positionX = reader.i32();
+            state.positionY = reader.i32();
+            for(std::uint32_t i = reader.count(8); i > 0; i--) {
+                std::string map = reader.str();
+                state.events[map] = reader.bytes();
+            }
+            return !reader.failed && reader.atEnd();
+        }
+    } // namespace
+
+    SaveGame::SaveGame(): thread(&SaveGame::run, this) {}
+
+    SaveGame::~SaveGame() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        thread.join();
+    }
+
+    SaveGame &SaveGame::getInstance() {
+        static SaveGame instance;
+        return instance;
+    }
+
+    std::shared_ptr<const SaveGame::State>
+        SaveGame::capture(Player &player, OverworldData &overworld,
+                          sf::Vector2i const &position) {
+        auto state = std::make_shared<State>();
+        state->playerName = toUtf8(player.getName());
+        std::vector<int> const &bag = player.getBag();
+        for(unsigned int i = 0; i < bag.size(); i++) {
+            if(bag[i] != 0) {
+                state->bag[ItemId::fromIndex(i).getName()] = bag[i];
+            }
+        }
+        OpTeam &team = *player.getOpTeam();
+        for(int i = 0; i < team.getSize(); i++) {
+            if(team[i] != nullptr) {
+                state->team.push_back(captureOpMon(*team[i]));
+            }
+        }
+        for(OpMon *opmon : player.getPc()) {
+            state->pc.push_back(captureOpMon(*opmon));
+        }
+        state->map = overworld.getCurrentMapId().getName();
+        state->positionX = position.x;
+        state->positionY = position.y;
+        for(MapId map : overworld.getMapIds()) {
+            std::vector<std::uint8_t> events = overworld.getEventStates(map);
+            for(std::uint8_t event : events) {
+                if(event != 0) {
+                    state->events[map.getName()] = std::move(events);
+                    break;
+                }
+            }
+        }
+        return state;
+    }
+
+    void SaveGame::apply(State const &state, GameData &gamedata,
+                         Player &player, OverworldData &overworld) {
+        // Checks the references to the game data before changing anything
+        for(auto const *opmons : {&state.team, &state.pc}) {
+            for(OpMonState const &opmon : *opmons) {
+                if(!gamedata.hasOp(opmon.species)) {
+                    throw Utils::LoadingException(
+                        "the save (unknown species " +
+                        std::to_string(opmon.species) + ")");
+                }
+            }
+        }
+        std::vector<MapId> const &maps = overworld.getMapIds();
+        if(std::find(maps.begin(), maps.end(), MapId::find(state.map)) ==
+           maps.end()) {
+            throw Utils::LoadingException("the save (unknown map " +
+                                          state.map + ")");
+        }
+
+        player.clear();
+        player.setName(fromUtf8(state.playerName));
+        for(auto const &[item, count] : state.bag) {
+            player.setItemCount(ItemId::find(item), count);
+        }
+        for(OpMonState const &opmon : state.team) {
+            player.addOpToOpTeam(createOpMon(opmon, gamedata));
+        }
+        for(OpMonState const &opmon : state.pc) {
+            player.addOpMonToPC(createOpMon(opmon, gamedata));
+        }
+        for(auto const &[map, events] : state.events) {
+            overworld.setEventStates(MapId::find(map), events);
+        }
+    }
+
+    void SaveGame::write(std::shared_ptr<const State> state,
+                         std::string const &path) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending[path] = std::move(state);
+        }
+        condition.notify_all();
+    }
+
+    void SaveGame::flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return pending.empty() && !writing; });
+    }
+
+    void SaveGame::run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true) {
+            condition.wait(lock, [this] { return stopping || !pending.empty(); });
+            if(pending.empty()) {
+                return; // Stopping, and everything has been written
+            }
+            auto next = pending.begin();
+            std::string path = next->first;
+            std::shared_ptr<const State> state = std::move(next->second);
+            pending.erase(next);
+            writing = true;
+            lock.unlock();
+            if(!writeFile(*state, path)) {
+                Utils::Log::warn("Unable to write the save " + path);
+            }
+            lock.lock();
+            writing = false;
+            condition.notify_all();
+        }
+    }
+
+    bool SaveGame::writeFile(State const &state, std::string const &path) {
+        std::vector<std::uint8_t> data = serialize(state);
+        std::vector<std::uint8_t> compressed = Utils::Compression::compress(data);
+
+        std::vector<std::uint8_t> file(MAGIC, MAGIC + sizeof(MAGIC));
+        Writer header(file);
+        header.u32(VERSION);
+        header.u32(data.size());
+        header.u32(checksum(data));
+        file.insert(file.end(), compressed.begin(), compressed.end());
+
+        std::error_code error;
+        std::filesystem::path parent = std::filesystem::path(path).parent_path();
+        if(!parent.empty()) {
+            std::filesystem::create_directories(parent, error);
+        }
+        // Replaces the previous save only once the new one is on the disk
+        if(!Utils::Fs::replaceFile(path, file.data(), file.size())) {
+            return false;
+        }
+        Utils::Log::oplog("Game saved in " + path);
+        return true;
+    }
+
+    SaveGame::State SaveGame::read(std::string const &path) {
+        std::ifstream stream(path, std::ios::binary);
+        if(!stream) {
+            throw Utils::LoadingException(path);
+        }
+        std::vector<std::uint8_t> file((std::istreambuf_iterator<char>(stream)),
+                                       std::istreambuf_iterator<char>());
+        if(file.size() < HEADER_SIZE ||
+           std::memcmp(file.data(), MAGIC, sizeof(MAGIC)) != 0) {
+            throw Utils::LoadingException(path);
+        }
+        std::vector<std::uint8_t> header(file.begin() + sizeof(MAGIC),
+                                         file.begin() + HEADER_SIZE);
+        Reader headerReader(header);
+        std::uint32_t version = headerReader.u32();
+        std::uint32_t size = headerReader.u32();
+        std::uint32_t expectedChecksum = headerReader.u32();
+        if(version == 0 || version > VERSION) {
+            Utils::Log::warn("The save " + path + " comes from version " +
+                             std::to_string(version) +
+                             " of the format, which is not supported.");
+            throw Utils::LoadingException(path);
+        }
+
+        std::vector<std::uint8_t> data;
+        State state;
+        if(!Utils::Compression::decompress(
+               std::vector<std::uint8_t>(file.begin() + HEADER_SIZE,
+                                         file.end()),
+               size, data) ||
+           checksum(data) != expectedChecksum ||
+           !deserialize(data, version, state)) {
+            Utils::Log::warn("The save " + path + " is corrupted.");
+            throw Utils::LoadingException(path);
+        }
+
+        auto &migrations = getMigrations();
+        for(std::uint32_t from = version; from < VERSION; from++) {
+            auto migration = migrations.find(from);
+            if(migration != migrations.end()) {
+                migration->second(state);
+            }
+        }
+        state.version = VERSION;
+        return state;
+    }
+
+    void SaveGame::addMigration(std::uint32_t from, Migration migration) {
+        getMigrations()[from] = std::move(migration);
+    }
+
+    std::map<std::uint32_t, SaveGame::Migration> &SaveGame::getMigrations() {
+        static std::map<std::uint32_t, Migration> migrations;
+        return migrations;
+    }
+
+} // namespace OpMon
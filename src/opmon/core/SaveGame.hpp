@@ -0,0 +1,184 @@
+/*!
+ * \file SaveGame.hpp
+ * \brief Binary save files.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace OpMon {
+    class GameData;
+    class OpMon;
+    class OverworldData;
+    class Player;
+
+    /*!
+     * \brief Reads and writes the save files.
+     * \details Saving is done in two steps, so that it never slows down a frame. capture() copies the state of the game in a SaveGame::State on the main thread: the state only contains numbers and strings, so the copy is short. The state can't be modified afterwards, so it is shared with the writing thread without any copy. write() then gives it to a background thread, which serializes, compresses and writes it.
+     *
+     * The file is first written next to the save, with the extension ".tmp", flushed to the disk, then renamed over the save (see Utils::Fs::replaceFile()). If the game or the system crashes during the writing, the previous save is left untouched.
+     *
+     * A save file contains, in little-endian:
+     * - The magic bytes "OPMS";
+     * - The version of the format (4 bytes);
+     * - The size of the uncompressed data (4 bytes);
+     * - The FNV-1a checksum of the uncompressed data (4 bytes);
+     * - The data, compressed by Utils::Compression.
+     *
+     * When the format changes, VERSION is incremented. read() still reads the fields of the older versions, then applies the migrations registered with addMigration() to fill what they lack.
+     * \note This class is a singleton. It can only be acceded by using getInstance().
+     */
+    class SaveGame {
+      public:
+        /*!
+         * \brief The version of the format written by the game.
+         */
+        static constexpr std::uint32_t VERSION = 1;
+
+        /*!
+         * \brief The saved data of an OpMon.
+         */
+        struct OpMonState {
+            unsigned int species = 0;
+            /*!
+             * \brief The nickname, in UTF-8.
+             */
+            std::string nickname;
+            int level = 1;
+            unsigned int nature = 0;
+            int hp = 0;
+            int status = 0;
+            int exp = 0;
+            std::array<int, 6> ivs {};
+            std::array<int, 6> evs {};
+            /*!
+             * \brief The ids of the moves, empty for an empty slot.
+             */
+            std::array<std::string, 4> moves;
+            std::array<int, 4> pp {};
+        };
+
+        /*!
+         * \brief All the data of a save.
+         */
+        struct State {
+            /*!
+             * \brief The version of the format the state has been read from.
+             */
+            std::uint32_t version = VERSION;
+            /*!
+             * \brief The name of the player, in UTF-8.
+             */
+            std::string playerName;
+            /*!
+             * \brief The number of each item in the bag, by item id.
+             */
+            std::map<std::string, int> bag;
+            std::vector<OpMonState> team;
+            std::vector<OpMonState> pc;
+            /*!
+             * \brief The id of the map where the player is.
+             */
+            std::string map;
+            int positionX = 0;
+            int positionY = 0;
+            /*!
+             * \brief The states of the events, by map id (see OverworldData::getEventStates()). Maps whose events haven't changed are not saved.
+             */
+            std::map<std::string, std::vector<std::uint8_t>> events;
+        };
+
+        /*!
+         * \brief A function updating a state read from an older version of the format.
+         */
+        using Migration = std::function<void(State &)>;
+
+        SaveGame(SaveGame const &) = delete;
+        void operator=(SaveGame const &) = delete;
+        ~SaveGame();
+
+        static SaveGame &getInstance();
+
+        /*!
+         * \brief Copies the state of the game. Must be called on the main thread.
+         * \param position The position of the player on the current map, in squares.
+         */
+        static std::shared_ptr<const State>
+            capture(Player &player, OverworldData &overworld,
+                    sf::Vector2i const &position);
+
+        /*!
+         * \brief Restores the player, their OpMon, their bag and the states of the events.
+         * \details The current map and the position of the player are not changed: they have to be used by the screen resuming the game.
+         * \throws Utils::LoadingException If the state refers to a species or a map which doesn't exist. Nothing is changed in this case.
+         */
+        static void apply(State const &state, GameData &gamedata,
+                          Player &player, OverworldData &overworld);
+
+        /*!
+         * \brief Writes a state in a file, in the background.
+         * \details Returns immediately. If the same file is saved again before the writing starts, only the last state is written.
+         * \param path The path of the file.
+         */
+        void write(std::shared_ptr<const State> state, std::string const &path);
+
+        /*!
+         * \brief Waits until all the saves given to write() are written.
+         */
+        void flush();
+
+        /*!
+         * \brief Reads a save file.
+         * \throws Utils::LoadingException If the file can't be read, is corrupted or comes from a newer version of the game.
+         */
+        static State read(std::string const &path);
+
+        /*!
+         * \brief Registers a migration, applied by read() to the states read from the version `from`.
+         * \details The migrations are applied in order, from the version of the file up to VERSION.
+         */
+        static void addMigration(std::uint32_t from, Migration migration);
+
+      private:
+        SaveGame();
+
+        /*!
+         * \brief The loop of the writing thread.
+         */
+        void run();
+
+        /*!
+         * \brief Serializes, compresses and writes a state.
+         * \returns `false` if the file couldn't be written.
+         */
+        static bool writeFile(State const &state, std::string const &path);
+
+        static std::map<std::uint32_t, Migration> &getMigrations();
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        /*!
+         * \brief The saves waiting to be written, by path.
+         */
+        std::map<std::string, std::shared_ptr<const State>> pending;
+        /*!
+         * \brief `true` while the writing thread writes a file.
+         */
+        bool writing = false;
+        bool stopping = false;
+        std::thread thread;
+    };
+
+} // namespace OpMon
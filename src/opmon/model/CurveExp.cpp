@@ -5,60 +5,120 @@
 */
 #include "CurveExp.hpp"
 
-#include <cmath>
-#include <memory>
+#include <array>
+#include <string>
 
 #include "src/utils/exceptions.hpp"
 
 namespace OpMon {
-    float CurveExpErratic::p(int x) {
-        switch(x) {
-            case 0:
-                return 0;
-            case 2:
-                return 0.014;
-            default:
-                return 0.008;
+
+    namespace {
+        /*
+         * The formulas are evaluated in integer arithmetic, multiplying before
+         * dividing, so the result is the floor of the exact value.
+         */
+        constexpr long long cube(long long n) { return n * n * n; }
+
+        constexpr long long erratic(long long n) {
+            if(n <= 50) {
+                return cube(n) * (100 - n) / 50;
+            } else if(n <= 68) {
+                return cube(n) * (150 - n) / 100;
+            } else if(n <= 98) {
+                return cube(n) * ((1911 - 10 * n) / 3) / 500;
+            } else {
+                return cube(n) * (160 - n) / 100;
+            }
         }
-    }
 
-    int CurveExpErratic::getNeededExp(int n) {
-        if(0 < n && n <= 50) {
-            return round(pow(n, 3) * ((100 - n) / 50));
-        } else if(51 <= n && n <= 68) {
-            return round(pow(n, 3) * ((150 - n) / 50));
-        } else if(69 <= n && n <= 98) {
-            return round(1.274f - ((1 / 50) * (n / 3)) - p(n % 3));
-        } else if(n >= 99) {
-            return round(pow(n, 3) * ((160 - n) / 100));
-        } else {
-            throw Utils::UnexpectedValueException(
-                std::to_string(n),
-                "a positive integer in CurveExpErratic::getNeededExp");
+        constexpr long long fluctuating(long long n) {
+            if(n <= 15) {
+                return cube(n) * ((n + 1) / 3 + 24) / 50;
+            } else if(n <= 36) {
+                return cube(n) * (n + 14) / 50;
+            } else {
+                return cube(n) * (n / 2 + 32) / 50;
+            }
+        }
+
+        constexpr long long slow(long long n) { return 5 * cube(n) / 4; }
+
+        constexpr long long normal(long long n) { return cube(n); }
+
+        constexpr long long parabolic(long long n) {
+            return 6 * cube(n) / 5 - 15 * n * n + 100 * n - 140;
+        }
+
+        constexpr long long quick(long long n) { return 4 * cube(n) / 5; }
+
+        using ExpTable = std::array<int, CurveExp::MAX_LEVEL + 1>;
+
+        /*
+         * Builds the table of the total experience needed for each level,
+         * from 1 to CurveExp::MAX_LEVEL. Index 0 is unused.
+         */
+        constexpr ExpTable makeTable(long long (*formula)(long long)) {
+            ExpTable table{};
+            for(int n = 1; n <= CurveExp::MAX_LEVEL; n++) {
+                table[n] = formula(n);
+            }
+            return table;
+        }
+
+        constexpr ExpTable erraticTable = makeTable(erratic);
+        constexpr ExpTable fluctuatingTable = makeTable(fluctuating);
+        constexpr ExpTable slowTable = makeTable(slow);
+        constexpr ExpTable normalTable = makeTable(normal);
+        constexpr ExpTable parabolicTable = makeTable(parabolic);
+        constexpr ExpTable quickTable = makeTable(quick);
+
+        // The values at level 100 must match the maximum experience used by
+        // Species to choose a curve.
+        static_assert(erraticTable[100] == 600000);
+        static_assert(fluctuatingTable[100] == 1640000);
+        static_assert(slowTable[100] == 1250000);
+        static_assert(normalTable[100] == 1000000);
+        static_assert(parabolicTable[100] == 1059860);
+        static_assert(quickTable[100] == 800000);
+
+        /*
+         * Looks the level up in the table. Levels above the maximum are still
+         * computed (the next level is queried at level 100), but are never
+         * reached.
+         */
+        int lookup(ExpTable const &table, long long (*formula)(long long),
+                   int n, const char *curveName) {
+            if(n < 1) {
+                throw Utils::UnexpectedValueException(
+                    std::to_string(n),
+                    std::string("a positive integer in ") + curveName +
+                        "::getNeededExp");
+            }
+            return n <= CurveExp::MAX_LEVEL ? table[n] : formula(n);
         }
+    } // namespace
+
+    int CurveExpErratic::getNeededExp(int n) {
+        return lookup(erraticTable, erratic, n, "CurveExpErratic");
     }
 
     int CurveExpFluctuating::getNeededExp(int n) {
-        if(0 < n && n <= 15) {
-            return round(pow(n, 3) * ((24 + floor((n + 1) / 3) / 50)));
-        } else if(16 <= n && n <= 35) {
-            return round(pow(n, 3) * ((14 + n) / 50));
-        } else if(n >= 36) {
-            return round(pow(n, 3) * ((32 + floor(n / 2)) / 50));
-        } else {
-            throw Utils::UnexpectedValueException(
-                std::to_string(n),
-                "a positive integer in CurveExpFluctuating::getNeededExp");
-        }
+        return lookup(fluctuatingTable, fluctuating, n, "CurveExpFluctuating");
     }
 
-    int CurveExpSlow::getNeededExp(int n) { return round(1.25f * pow(n, 3)); }
+    int CurveExpSlow::getNeededExp(int n) {
+        return lookup(slowTable, slow, n, "CurveExpSlow");
+    }
 
-    int CurveExpNormal::getNeededExp(int n) { return round(pow(n, 3)); }
+    int CurveExpNormal::getNeededExp(int n) {
+        return lookup(normalTable, normal, n, "CurveExpNormal");
+    }
 
     int CurveExpParabolic::getNeededExp(int n) {
-        return round(1.2f * pow(n, 3) - 15 * pow(n, 2) + (100 * n) - 140);
+        return lookup(parabolicTable, parabolic, n, "CurveExpParabolic");
     }
 
-    int CurveExpQuick::getNeededExp(int n) { return round(0.8f * pow(n, 3)); }
+    int CurveExpQuick::getNeededExp(int n) {
+        return lookup(quickTable, quick, n, "CurveExpQuick");
+    }
 } // namespace OpMon
@@ -15,6 +15,12 @@ namespace OpMon {
      */
     class CurveExp {
       public:
+        /*!
+         * \brief The maximum level of an OpMon.
+         * \details The experience needed for the levels up to this one is precomputed at compile time.
+         */
+        static constexpr int MAX_LEVEL = 100;
+
         /*!
          * \return The total experience points at the given level.
          * \param n The level.
@@ -24,12 +30,6 @@ namespace OpMon {
     };
 
     class CurveExpErratic : public CurveExp {
-      private:
-        /*!
-         * \brief A intermediary function to calculate the needed exp.
-         */
-        float p(int x);
-
       public:
         /*!
          * \copydoc CurveExp::getNeededExp()
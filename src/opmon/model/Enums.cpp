@@ -6,10 +6,15 @@
 */
 #include "Enums.hpp"
 
+#include <array>
+
 namespace OpMon {
 
     namespace ArrayTypes {
-        const float arrTypes[][18] = {
+        /*
+         * Effectiveness of a single type, indexed as [defType][atkType].
+         */
+        constexpr float arrTypes[18][18] = {
 
             {LO_, HI_, LO_, AVG, AVG, LO_, HI_, LO_, LO_, LO_, LO_, NOT, LO_,
              LO_, HI_, AVG, AVG, LO_},
@@ -48,13 +53,58 @@ namespace OpMon {
             {AVG, LO_, AVG, AVG, HI_, AVG, AVG, HI_, LO_, AVG, LO_, AVG, AVG,
              HI_, NOT, AVG, AVG, AVG}};
 
+        /*
+         * Index 18 of the defending types stands for Type::NOTHING, so that a
+         * single lookup covers single-typed OpMon too.
+         */
+        constexpr int TYPE_COUNT = 18;
+        constexpr int DEF_COUNT = TYPE_COUNT + 1;
+
+        using DualTable =
+            std::array<std::array<std::array<float, DEF_COUNT>, DEF_COUNT>,
+                       TYPE_COUNT>;
+
+        constexpr float singleEffectiveness(int atk, int def) {
+            return def == TYPE_COUNT ? 1 : arrTypes[def][atk];
+        }
+
+        constexpr DualTable makeDualTable() {
+            DualTable table{};
+            for(int atk = 0; atk < TYPE_COUNT; atk++) {
+                for(int def1 = 0; def1 < DEF_COUNT; def1++) {
+                    for(int def2 = 0; def2 < DEF_COUNT; def2++) {
+                        table[atk][def1][def2] =
+                            singleEffectiveness(atk, def1) *
+                            singleEffectiveness(atk, def2);
+                    }
+                }
+            }
+            return table;
+        }
+
+        /*
+         * Effectiveness of every move type against every pair of types,
+         * indexed as [atkType][def1][def2]. Generated at compile time.
+         */
+        constexpr DualTable dualTypes = makeDualTable();
+
+        static_assert(dualTypes[(int)Type::NEUTRAL][(int)Type::GHOST]
+                               [TYPE_COUNT] == NOT);
+        static_assert(dualTypes[(int)Type::METAL][(int)Type::METAL]
+                               [(int)Type::METAL] == VLO);
+
+        /*
+         * Converts a Type into its index in dualTypes' defending dimensions.
+         */
+        constexpr int defIndex(Type type) {
+            return type == Type::NOTHING ? TYPE_COUNT : (int)type;
+        }
+
         float calcEffectiveness(Type atk, Type def1, Type def2) {
-            int atkI((int)atk), type1I((int)def1), type2I((int)def2);
-            if(def2 == Type::NOTHING) {
-                return arrTypes[type1I][atkI];
-            } else {
-                return arrTypes[type1I][atkI] * arrTypes[type2I][atkI];
+            if(atk == Type::NOTHING) {
+                return AVG;
             }
+            return dualTypes[(int)atk][defIndex(def1)][defIndex(def2)];
         }
     } // namespace ArrayTypes
 
@@ -8,120 +8,71 @@
 #ifndef SRCCPP_JLPPC_REGIMYS_OBJECTS_ATTAQUE_HPP_
 #define SRCCPP_JLPPC_REGIMYS_OBJECTS_ATTAQUE_HPP_
 
-#include <filesystem>
+#include <SFML/System/String.hpp>
 #include <queue>
+#include <string>
 
-#include "../view/elements/Turn.hpp"
-#include "../view/ui/Elements.hpp"
-#include "src/utils/i18n/ATranslatable.hpp"
+#include "Enums.hpp"
+#include "src/opmon/core/Ids.hpp"
 
 namespace OpMon {
 
     class OpMon;
-    class Move;
+    struct MoveData;
 
-    /*!
-     * \brief This class is virtual and one has to be created for each move effect.
-     */
-    class MoveEffect {
-      public:
-        /*!
-          \brief Applies the effect.
-        */
-        virtual int apply(Move & /*move*/, OpMon & /*attacker*/,
-                          OpMon & /*defender*/,
-                          std::queue<Elements::TurnAction> & /* turnQueue */) {
-            return 0;
-        }
-        virtual ~MoveEffect() {}
-    };
-
-    /*!
-     * \struct MoveData
-     * \brief Contains all the necessary data to create an Move.
-     * \details This structure is used in the class Move to link all the variables needed to the constructor in one variable. It represents the move in an abstract way, while Move represents an move owned by an OpMon.
-     */
-    struct MoveData {
-        std::string
-            nameKey; /*!< \brief The key (see Utils::StringKeys) used to get the move name in the right language.*/
-        int power;   /*!< \brief  The power of the move.*/
-        Type type;   /*!< \brief  The type of the move.*/
-        int accuracy; /*!< \brief  The accuracy of the move*/
-        bool
-            special; /*!< \brief  If `true`, the move is a special move (uses the special stats). Else, the move is a physical move (uses the basic stats).*/
-        bool
-            status; /*!< \brief  If `true`, the move does not harm directly the opposite OpMon.*/
-        int criticalRate; /*!< \brief  The critical rate of the move. It represents the denominator (one chance out of the value of the variable)*/
-        bool neverFails;  /*!< \brief  If `true`, the move can't fail.*/
-        int ppMax; /*!< \brief The maximum base PP (Power points) of the move.*/
-        int priority; /*!< \brief The level of priority of the move.*/
-        MoveEffect *preEffect =
-            nullptr; /*!< \brief The move effect applied before the calculation of the damages.*/
-        MoveEffect *postEffect =
-            nullptr; /*!< \brief The move effect applied after the calculation of the damages.*/
-        MoveEffect *ifFails =
-            nullptr; /*!< \brief The move effect applied if the move fails.*/
-        std::vector<Elements::TurnActionType>
-            animationOrder; /*!< \brief The order in which the animations will occur.*/
-        std::queue<Ui::Transformation>
-            opAnimsAtk; /*!< \brief The animations linked to the attacking OpMon's sprite.*/
-        std::queue<Ui::Transformation>
-            opAnimsDef; /*!< \brief The animations linked to the attacked OpMon's sprite.*/
-        std::queue<std::string>
-            animations; /*!< \brief The animations played on the whole screen.*/
-    };
+    namespace Elements {
+        struct TurnAction;
+    } // namespace Elements
 
-    typedef struct MoveData MoveData;
+    namespace Ui {
+        class Transformation;
+    } // namespace Ui
 
     /*!
      * \class Move
-     * \brief Describes an move.
-     * \details This class describes an move owned by an OpMon, and not just an move in general (MoveData is used for this, the moves are stored in Move::moveList).
-     * \todo Change the name to "move" to stick better with the original game.
+     * \brief Describes a move owned by an OpMon.
+     * \details This class only holds a pointer to the shared definition of the move (see MoveData) and the data specific to the OpMon, like the current PP. It is cheap to copy. A default-constructed Move is an empty move slot.
      */
-    class Move : public Utils::I18n::ATranslatable {
+    class Move {
       public:
-        virtual ~Move();
         /*!
-         * \brief Creates an move with all the needed data.
-         * \note To see the details of the parameters, see MoveData.
+         * \brief Creates an empty move slot.
+         */
+        Move() = default;
+
+        /*!
+         * \brief Creates a move from its definition in MoveRegistry.
+         * \details If the move doesn't exist, a warning is logged and the move slot is empty.
+         * \param id The id of the move.
          */
-        Move(std::string nameKey, int power, Type type, int accuracy,
-             bool special, bool status, int criticalRate, bool neverFails,
-             int ppMax, int priority,
-             std::vector<Elements::TurnActionType> animationOrder,
-             std::queue<Ui::Transformation> opAnimsAtk,
-             std::queue<Ui::Transformation> opAnimsDef,
-             std::queue<std::string> animations,
-             MoveEffect *preEffect = nullptr, MoveEffect *postEffect = nullptr,
-             MoveEffect *fails = nullptr);
+        Move(std::string const &id);
 
         /*!
-         * \brief Creates and move with all the data stored in the MoveData structure.
+         * \brief Creates a move from a definition.
+         * \param data The definition of the move. It must outlive the move.
          */
         Move(MoveData const &data);
 
         /*!
-         * \brief Returns a pointer to a new Move object created by using the parameter to access an MoveData object stored in Move::moveList.
-         * \param name Key used to identify the wanted move in Move::moveList.
+         * \brief Returns `true` if the move slot is empty.
          */
-        static Move *newMove(std::string name);
+        bool isEmpty() const { return data == nullptr; }
+
         /*!
-         * \brief Initialises the moves and stores them in Move::moveList.
-         * \param file The file containing the data to load (Json format).
+         * \brief Returns the id of the move, or an invalid id if the slot is empty.
          */
-        static void initMoves(std::filesystem::directory_iterator dir);
+        MoveId getId() const;
 
         /*!
          * \brief Resets the current PP number to the maximum.
          */
-        void healPP() { pp = ppMax; }
+        void healPP();
 
-        Type getType() { return type; }
+        Type getType() const;
 
-        int getPP() { return pp; }
+        int getPP() const { return pp; }
 
-        int getPPMax() { return ppMax; }
+        int getPPMax() const;
 
         /*!
          * \brief Causes a OpMon to move another one.
@@ -135,63 +86,29 @@ namespace OpMon {
 
         void setPP(int PP) { this->pp = PP; }
 
-        void setPPMax(int PPMax) { this->ppMax = PPMax; }
-
-        int getPriority() { return this->priority; }
+        int getPriority() const;
 
-        sf::String getName() { return name; }
+        const sf::String &getName() const;
 
-        std::queue<Ui::Transformation> getOpAnimsAtk() const {
-            return opAnimsAtk;
-        }
+        const std::queue<Ui::Transformation> &getOpAnimsAtk() const;
 
-        std::queue<Ui::Transformation> getOpAnimsDef() const {
-            return opAnimsDef;
-        }
+        const std::queue<Ui::Transformation> &getOpAnimsDef() const;
 
-        std::queue<std::string> getAnimations() const { return animations; }
+        const std::queue<std::string> &getAnimations() const;
 
         // methods used by pre and post Effects
 
-        void setPower(int power) { this->power = power; }
-        int getAccuracy() { return this->accuracy; }
-        void setAccuracy(int accuracy) { this->accuracy = accuracy; }
-        int getPart() { return part; }
+        int getAccuracy() const;
+        int getPart() const { return part; }
         void setPart(int part) { this->part = part; }
-        int getHpLost() { return this->hpLost; }
-
-        void onLangChanged();
+        int getHpLost() const { return this->hpLost; }
 
       protected:
-        Utils::OpString
-            nameKey; /*!<\brief The key (see Utils::StringKeys) used to get the move name in the right language.*/
-        sf::String name; /*!<\brief The move name in the current language.*/
-        int power;       /*!< \brief The power of the move.*/
-        Type type;       /*!< \brief The type of the move.*/
-        int accuracy;    /*!< \brief The accuracy of the move*/
-        bool
-            special; /*!< \brief If `true`, the move is a special move (uses the special stats). Else, the move is a physical move (uses the basic stats).*/
-        bool
-            status; /*!< \brief If `true`, the move does not harm directly the opposite OpMon.*/
-        int criticalRate; /*!< \brief The critical rate of the move. It represents the denominator (one chance out of the value of the variable)*/
-        bool neverFails;  /*!< \brief If `true`, the move can't fail.*/
-        int pp;           /*!<\brief The current pp of the move.*/
-        int ppMax; /*!< \brief The maximum base PP (Power points) of the move.*/
-        int priority; /*!< \brief The level of priority of the move.*/
-        MoveEffect *
-            preEffect; /*!< \brief The move effect applied before the calculation of the damages.*/
-        MoveEffect *
-            postEffect; /*!< \brief The move effect applied after the calculation of the damages.*/
-        MoveEffect *
-            failEffect; /*!< \brief The move effect applied if the move fails.*/
-        std::vector<Elements::TurnActionType>
-            animationOrder; /*!< \brief The order in which the animations will occur.*/
-        std::queue<Ui::Transformation>
-            opAnimsAtk; /*!< \brief The animations linked to the attacking OpMon's sprite.*/
-        std::queue<Ui::Transformation>
-            opAnimsDef; /*!< \brief The animations linked to the attacked OpMon's sprite.*/
-        std::queue<std::string>
-            animations; /*!< \brief The animations played on the whole screen.*/
+        /*!
+         * \brief The shared definition of the move.
+         */
+        const MoveData *data = nullptr;
+        int pp = 0; /*!<\brief The current pp of the move.*/
 
         /*!
          * \brief The number of HP lost by the opposite OpMon.
@@ -201,18 +118,6 @@ namespace OpMon {
          * \brief Used for moves in multiple turns.
          */
         int part = 0;
-
-        /*!
-         * \brief Map containing the data of all the available moves in the game.
-         */
-        static std::map<std::string, MoveData> moveList;
-
-        /*!
-         * \brief Generates the other version of the OpMon animations.
-         * \details The OpMon animations are created to be used with the player's OpMon. This method generates opposite OpMon versions by creating a symmetry from the origin.
-         */
-        std::queue<Ui::Transformation> generateDefAnims(
-            std::queue<Ui::Transformation> opAnims);
     };
 
 } // namespace OpMon
@@ -0,0 +1,163 @@
+/*
+  MoveData.cpp
+  Author : Cyrielle
+  Contributors : BAKFR, torq, Navet56
+  File under GNU GPL v3.0 license
+*/
+#include "MoveData.hpp"
+
+#include <SFML/System/Vector2.hpp>
+#include <fstream>
+#include <memory>
+
+#include "../../nlohmann/json.hpp"
+#include "../../utils/log.hpp"
+#include "Moves.hpp"
+#include "src/opmon/model/Enums.hpp"
+#include "src/opmon/view/elements/Turn.hpp"
+#include "src/opmon/view/ui/Elements.hpp"
+
+namespace OpMon {
+
+    MoveRegistry &MoveRegistry::getInstance() {
+        static MoveRegistry instance;
+
+        return instance;
+    }
+
+    const MoveData *MoveRegistry::get(MoveId id) const {
+        return id.getIndex() < moveList.size() ? moveList[id.getIndex()].get()
+                                               : nullptr;
+    }
+
+    void MoveRegistry::onLangChanged() {
+        for(auto &data : moveList) {
+            if(data != nullptr) {
+                data->name = stringkeys.get(data->nameKey);
+            }
+        }
+    }
+
+    void MoveRegistry::load(std::filesystem::directory_iterator dir) {
+        for(std::filesystem::directory_entry const &file : dir) {
+            if(file.is_regular_file()) {
+                std::ifstream jsonStream(file.path());
+                nlohmann::json json;
+
+                jsonStream >> json;
+
+                for(auto itor = json.begin(); itor != json.end(); ++itor) {
+                    std::string idStr = itor->at("id");
+                    MoveId id = MoveId::intern(idStr);
+                    if(get(id) != nullptr) {
+                        continue;
+                    }
+                    if(id.getIndex() >= moveList.size()) {
+                        moveList.resize(id.getIndex() + 1);
+                    }
+                    moveList[id.getIndex()] = std::make_unique<MoveData>();
+                    MoveData &move = *moveList[id.getIndex()];
+                    std::vector<std::unique_ptr<MoveEffect> *> effects = {
+                        &move.preEffect, &move.postEffect, &move.ifFails};
+                    move.id = id;
+                    move.nameKey = std::string("moves.") + idStr + ".name";
+                    move.name = stringkeys.get(move.nameKey);
+                    move.power = itor->at("power");
+                    move.type = itor->at("type");
+                    move.accuracy = itor->at("accuracy");
+                    move.special = itor->at("special");
+                    move.status = itor->at("status");
+                    move.criticalRate = itor->at("criticalRate");
+                    move.neverFails = itor->at("neverFails");
+                    move.ppMax = itor->at("ppMax");
+                    move.priority = itor->at("priority");
+                    int i = 0;
+                    for(auto eitor = itor->at("effects").begin();
+                        eitor != itor->at("effects").end(); ++eitor) {
+                        if(!eitor->at("null")) {
+                            std::string effectType = eitor->at("type");
+                            if(effectType == "ChangeStatEffect") {
+                                *(effects[i]) =
+                                    std::make_unique<Moves::ChangeStatEffect>(
+                                        eitor->at("data"));
+                            }
+                        }
+                        i++;
+                    }
+                    for(unsigned int i = 0;
+                        i < itor->at("animationOrder").size(); i++) {
+                        move.animationOrder.push_back(
+                            itor->at("animationOrder").at(i));
+                    }
+
+                    for(int i = 0; i < 2; i++) {
+                        for(auto aitor = itor->at(i ? "opMovementsAtk" :
+                                                      "opMovementsDef")
+                                             .begin();
+                            aitor !=
+                            itor->at(i ? "opMovementsAtk" : "opMovementsDef")
+                                .end();
+                            ++aitor) {
+                            nlohmann::json transObj = aitor->value(
+                                "translation",
+                                nlohmann::json(
+                                    nlohmann::json::value_t::object));
+                            nlohmann::json rotObj = aitor->value(
+                                "rotation",
+                                nlohmann::json(
+                                    nlohmann::json::value_t::object));
+                            nlohmann::json scalObj = aitor->value(
+                                "scaling",
+                                nlohmann::json(
+                                    nlohmann::json::value_t::object));
+
+                            Ui::MovementData mov;
+                            Ui::RotationData rot;
+                            Ui::ScaleData scal;
+                            if(!transObj.empty()) {
+                                mov = Ui::Transformation::newMovementData(
+                                    transObj.at("mode").at(0),
+                                    transObj.at("mode").at(1),
+                                    transObj.at("formulas").at(0),
+                                    transObj.at("formulas").at(1));
+                            }
+
+                            if(!rotObj.empty()) {
+                                rot = Ui::Transformation::newRotationData(
+                                    rotObj.at("mode"), rotObj.at("formula"),
+                                    sf::Vector2f(rotObj.at("origin").at(0),
+                                                 rotObj.at("origin").at(1)));
+                            }
+
+                            if(!scalObj.empty()) {
+                                scal = Ui::Transformation::newScaleData(
+                                    scalObj.at("mode").at(0),
+                                    scalObj.at("mode").at(1),
+                                    scalObj.at("formulas").at(0),
+                                    scalObj.at("formulas").at(1),
+                                    sf::Vector2f(scalObj.at("origin").at(0),
+                                                 scalObj.at("origin").at(1)));
+                            }
+                            if(i) {
+                                move.opAnimsAtk.push(
+                                    Ui::Transformation(aitor->at("time"), mov,
+                                                       rot, scal));
+                            } else {
+                                move.opAnimsDef.push(
+                                    Ui::Transformation(aitor->at("time"), mov,
+                                                       rot, scal));
+                            }
+                        }
+                    }
+                    for(auto aitor = itor->at("animations").begin();
+                        aitor != itor->at("animations").end(); ++aitor) {
+                        move.animations.push(*aitor);
+                    }
+                    std::string atkStr = itor->at("id");
+                    Utils::Log::oplog("Loaded move " + atkStr);
+                }
+            }
+        }
+    }
+
+} // namespace OpMon
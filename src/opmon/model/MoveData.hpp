@@ -0,0 +1,128 @@
+/*!
+ * \file MoveData.hpp
+ * \authors Cyrielle
+ * \authors BAKFR
+ * \authors Navet56
+ * \copyright GNU GPL v3.0
+ */
+#ifndef MOVEDATA_HPP
+#define MOVEDATA_HPP
+
+#include <SFML/System/String.hpp>
+#include <filesystem>
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include "../view/elements/Turn.hpp"
+#include "../view/ui/Elements.hpp"
+#include "Move.hpp"
+#include "src/opmon/core/Ids.hpp"
+#include "src/utils/i18n/ATranslatable.hpp"
+
+namespace OpMon {
+
+    class OpMon;
+
+    /*!
+     * \brief This class is virtual and one has to be created for each move effect.
+     */
+    class MoveEffect {
+      public:
+        /*!
+          \brief Applies the effect.
+        */
+        virtual int apply(Move & /*move*/, OpMon & /*attacker*/,
+                          OpMon & /*defender*/,
+                          std::queue<Elements::TurnAction> & /* turnQueue */) {
+            return 0;
+        }
+        virtual ~MoveEffect() {}
+    };
+
+    /*!
+     * \struct MoveData
+     * \brief Contains the definition of a move.
+     * \details It represents the move in an abstract way, while Move represents a move owned by an OpMon. The definitions are owned by MoveRegistry and shared by all the Move objects, so they must not be modified after loading.
+     */
+    struct MoveData {
+        MoveId id; /*!< \brief The id of the move.*/
+        std::string
+            nameKey; /*!< \brief The key (see Utils::StringKeys) used to get the move name in the right language.*/
+        sf::String
+            name; /*!< \brief The move name in the current language. Updated by MoveRegistry when the language changes.*/
+        int power;   /*!< \brief  The power of the move.*/
+        Type type;   /*!< \brief  The type of the move.*/
+        int accuracy; /*!< \brief  The accuracy of the move*/
+        bool
+            special; /*!< \brief  If `true`, the move is a special move (uses the special stats). Else, the move is a physical move (uses the basic stats).*/
+        bool
+            status; /*!< \brief  If `true`, the move does not harm directly the opposite OpMon.*/
+        int criticalRate; /*!< \brief  The critical rate of the move. It represents the denominator (one chance out of the value of the variable)*/
+        bool neverFails;  /*!< \brief  If `true`, the move can't fail.*/
+        int ppMax; /*!< \brief The maximum base PP (Power points) of the move.*/
+        int priority; /*!< \brief The level of priority of the move.*/
+        std::unique_ptr<MoveEffect>
+            preEffect; /*!< \brief The move effect applied before the calculation of the damages.*/
+        std::unique_ptr<MoveEffect>
+            postEffect; /*!< \brief The move effect applied after the calculation of the damages.*/
+        std::unique_ptr<MoveEffect>
+            ifFails; /*!< \brief The move effect applied if the move fails.*/
+        std::vector<Elements::TurnActionType>
+            animationOrder; /*!< \brief The order in which the animations will occur.*/
+        std::queue<Ui::Transformation>
+            opAnimsAtk; /*!< \brief The animations linked to the attacking OpMon's sprite.*/
+        std::queue<Ui::Transformation>
+            opAnimsDef; /*!< \brief The animations linked to the attacked OpMon's sprite.*/
+        std::queue<std::string>
+            animations; /*!< \brief The animations played on the whole screen.*/
+    };
+
+    typedef struct MoveData MoveData;
+
+    /*!
+     * \brief Owns the definitions of all the moves of the game.
+     * \details The definitions are loaded once, then Move objects only keep a pointer to them. The only thing updated afterwards is the translated name of the moves.
+     * \note This class is a singleton. It can only be acceded by using getInstance().
+     */
+    class MoveRegistry : public Utils::I18n::ATranslatable {
+      public:
+        MoveRegistry(MoveRegistry const &) = delete;
+        void operator=(MoveRegistry const &) = delete;
+
+        static MoveRegistry &getInstance();
+
+        /*!
+         * \brief Loads the moves and stores them in the registry.
+         * \details Moves already loaded are skipped, so the pointers given by get() stay valid.
+         * \param dir The directory containing the files to load (Json format).
+         */
+        void load(std::filesystem::directory_iterator dir);
+
+        /*!
+         * \brief Returns the definition of a move.
+         * \param id The id of the move.
+         * \returns A pointer to the definition, or `nullptr` if it does not exist.
+         */
+        const MoveData *get(MoveId id) const;
+        /*!
+         * \brief Returns the definition of a move.
+         * \param id The string id of the move, resolved with MoveId::find.
+         */
+        const MoveData *get(std::string const &id) const {
+            return get(MoveId::find(id));
+        }
+
+        void onLangChanged() override;
+
+      private:
+        MoveRegistry() = default;
+
+        /*!
+         * \brief The data of all the available moves in the game, indexed by MoveId.
+         */
+        std::vector<std::unique_ptr<MoveData>> moveList;
+    };
+
+} // namespace OpMon
+#endif // MOVEDATA_HPP
@@ -9,7 +9,7 @@
 #define SRCCPP_JLPPC_REGIMYS_OBJECTS_ATTAQUES_HPP_
 
 #include "../../nlohmann/json.hpp"
-#include "Move.hpp"
+#include "MoveData.hpp"
 
 namespace OpMon {
     class OpMon;
@@ -5,11 +5,13 @@
 */
 #include "Nature.hpp"
 
+#include <array>
+
 #include "src/opmon/model/Enums.hpp"
 
 namespace OpMon {
 
-    const NatureClass BOLD = NatureClass(Stats::DEF, Stats::ATK, 0),
+    constexpr NatureClass BOLD = NatureClass(Stats::DEF, Stats::ATK, 0),
                       BASHFUL = NatureClass(Stats::NOTHING, Stats::NOTHING, 1),
                       BRAVE = NatureClass(Stats::ATK, Stats::SPE, 2),
                       CALM = NatureClass(Stats::DEFSPE, Stats::ATK, 3),
@@ -35,12 +37,47 @@ namespace OpMon {
                       LONELY = NatureClass(Stats::ATK, Stats::DEF, 23),
                       TIMID = NatureClass(Stats::SPE, Stats::ATK, 24);
 
-    const NatureClass natures[25] = {
+    constexpr NatureClass natures[25] = {
         BOLD,    BASHFUL, BRAVE,  CALM,  QUIET,   DOCILE, MILD,
         RASH,    GENTLE,  HARDY,  JOLLY, LAX,     IMPISH, SASSY,
         NAUGHTY, MODEST,  NAIVE,  HASTY, CAREFUL, QUIRKY, RELAXED,
         ADAMANT, SERIOUS, LONELY, TIMID};
 
+    namespace {
+        // Stats are indexed from Stats::NOTHING (0) to Stats::EVA (8)
+        constexpr int STATS_COUNT = 9;
+
+        using NatureTable = std::array<std::array<double, STATS_COUNT>, 25>;
+
+        constexpr NatureTable makeNatureTable() {
+            NatureTable table{};
+            for(int i = 0; i < 25; i++) {
+                for(int stat = 0; stat < STATS_COUNT; stat++) {
+                    table[i][stat] = 1;
+                }
+                // Neutral natures have Stats::NOTHING as bonus and malus.
+                if(natures[i].bonus != natures[i].malus) {
+                    table[i][(int)natures[i].bonus] = 1.1;
+                    table[i][(int)natures[i].malus] = 0.9;
+                }
+            }
+            return table;
+        }
+
+        constexpr NatureTable natureMultipliers = makeNatureTable();
+
+        static_assert(natureMultipliers[(int)Nature::BOLD][(int)Stats::DEF] ==
+                      1.1);
+        static_assert(natureMultipliers[(int)Nature::BOLD][(int)Stats::ATK] ==
+                      0.9);
+        static_assert(
+            natureMultipliers[(int)Nature::HARDY][(int)Stats::ATK] == 1);
+    } // namespace
+
+    double getNatureMultiplier(Nature nature, Stats stat) {
+        return natureMultipliers[(unsigned int)nature][(int)stat];
+    }
+
     bool operator==(NatureClass const &one, NatureClass const &two) {
         if((one.malus == two.malus) && (one.bonus == two.bonus)) {
             return true;
@@ -38,7 +38,7 @@ namespace OpMon {
          * \param malus \copydoc NatureClass::malus
          * \param id \copydoc NatureClass::id
          */
-        NatureClass(Stats bonus, Stats malus, int id)
+        constexpr NatureClass(Stats bonus, Stats malus, int id)
             : bonus(bonus), malus(malus), id(id) {};
     };
 
@@ -82,5 +82,13 @@ namespace OpMon {
         LONELY = 23,
         TIMID = 24
     };
+
+    /*!
+     * \brief Returns the multiplier applied by a nature to a stat.
+     * \details The values are precomputed at compile time : 1.1 for the bonus, 0.9 for the malus and 1 otherwise.
+     * \param nature The nature of the OpMon.
+     * \param stat The stat to modify.
+     */
+    double getNatureMultiplier(Nature nature, Stats stat);
 } // namespace OpMon
 #endif /* SRCCPP_JLPPC_REGIMYS_ENUMS_CARACTERE_HPP_ */
@@ -19,14 +19,10 @@
 
 namespace OpMon {
 
-    OpMon::~OpMon() {
-        for(int i = 0; i < 4; i++) {
-            delete(moves[i]);
-        }
-    }
+    OpMon::~OpMon() {}
 
     OpMon::OpMon(const std::string &nickname, const Species *species, int level,
-                 const std::vector<Move *> &moves, Nature nature)
+                 const std::array<Move, 4> &moves, Nature nature)
         : nickname((nickname.empty()) ? species->getName() : nickname),
           species(species),
           level(level),
@@ -69,7 +65,8 @@ namespace OpMon {
                         2 :
                         1))) /
              (3 * statHP)));
-        int b = round((pow(2, 16) - 1) * pow(a / (pow(2, 8) - 1), 0.25));
+        // 65535 * (a / 255) ^ (1/4)
+        int b = round(65535 * std::sqrt(std::sqrt(a / 255.0)));
         int c[] = {Utils::Misc::randU(65535), Utils::Misc::randU(65535),
                    Utils::Misc::randU(65535), Utils::Misc::randU(65535)};
         int nbreOk = 0;
@@ -222,39 +219,29 @@ namespace OpMon {
             ((((2 * species->getBaseAtk() + atkIV + (atkEV / 4)) * level) /
               100) +
              5) *
-            ((natures[(int)nature].bonus == Stats::ATK) ?
-                 1.1 :
-                 ((natures[(int)nature].malus == Stats::ATK) ? 0.9 : 1)));
+            getNatureMultiplier(nature, Stats::ATK));
         statDEF = round(
             ((((2 * species->getBaseDef() + defIV + (defEV / 4)) * level) /
               100) +
              5) *
-            ((natures[(int)nature].bonus == Stats::DEF) ?
-                 1.1 :
-                 ((natures[(int)nature].malus == Stats::DEF) ? 0.9 : 1)));
+            getNatureMultiplier(nature, Stats::DEF));
         statATKSPE = round(
             ((((2 * species->getBaseAtkSpe() + atkSpeIV + (atkSpeEV / 4)) *
                level) /
               100) +
              5) *
-            ((natures[(int)nature].bonus == Stats::ATKSPE) ?
-                 1.1 :
-                 ((natures[(int)nature].malus == Stats::ATKSPE) ? 0.9 : 1)));
+            getNatureMultiplier(nature, Stats::ATKSPE));
         statDEFSPE = round(
             ((((2 * species->getBaseDefSpe() + defSpeIV + (defSpeEV / 4)) *
                level) /
               100) +
              5) *
-            ((natures[(int)nature].bonus == Stats::DEFSPE) ?
-                 1.1 :
-                 ((natures[(int)nature].malus == Stats::DEFSPE) ? 0.9 : 1)));
+            getNatureMultiplier(nature, Stats::DEFSPE));
         statSPE = round(
             ((((2 * species->getBaseSpe() + speIV + (speEV / 4)) * level) /
               100) +
              5) *
-            ((natures[(int)nature].bonus == Stats::SPE) ?
-                 1.1 :
-                 ((natures[(int)nature].malus == Stats::SPE) ? 0.9 : 1)));
+            getNatureMultiplier(nature, Stats::SPE));
         statHP =
             round(((2 * species->getBaseHP() + hpIV + (hpEV / 4)) * level) /
                   100) +
@@ -272,8 +259,8 @@ namespace OpMon {
         species = species->getEvolution();
     }
 
-    void OpMon::setStats(int stats[], Move *moves[], const Species &species,
-                         Type types[]) {
+    void OpMon::setStats(int stats[], const std::array<Move, 4> &moves,
+                         const Species &species, Type types[]) {
         statATK = stats[0];
         statDEF = stats[1];
         statATKSPE = stats[2];
@@ -284,14 +271,38 @@ namespace OpMon {
         type1 = types[0];
         type2 = types[1];
         this->species = &species;
-        this->moves[0] = moves[0];
-        this->moves[1] = moves[1];
-        this->moves[2] = moves[2];
-        this->moves[3] = moves[3];
+        this->moves = moves;
         type1 = types[0];
         type2 = types[1];
     }
 
+    OpMon::Individual OpMon::getIndividual() const {
+        return {{atkIV, defIV, atkSpeIV, defSpeIV, speIV, hpIV},
+                {atkEV, defEV, atkSpeEV, defSpeEV, speEV, hpEV},
+                exp,
+                HP,
+                status};
+    }
+
+    void OpMon::setIndividual(Individual const &values) {
+        atkIV = values.ivs[0];
+        defIV = values.ivs[1];
+        atkSpeIV = values.ivs[2];
+        defSpeIV = values.ivs[3];
+        speIV = values.ivs[4];
+        hpIV = values.ivs[5];
+        atkEV = values.evs[0];
+        defEV = values.evs[1];
+        atkSpeEV = values.evs[2];
+        defSpeEV = values.evs[3];
+        speEV = values.evs[4];
+        hpEV = values.evs[5];
+        calcStats();
+        exp = values.exp;
+        HP = std::clamp(values.hp, 0, statHP);
+        status = values.status;
+    }
+
     void OpMon::attacked(int hpLost) {
         HP -= hpLost;
         // HP can't go below 0
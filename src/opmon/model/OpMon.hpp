@@ -13,16 +13,17 @@
 #define OPMON_HPP
 
 #include <SFML/System/String.hpp>
+#include <array>
 #include <cmath>
 
 #include "../../utils/misc.hpp"
+#include "Move.hpp"
 #include "Nature.hpp"
 #include "Species.hpp"
 
 namespace OpMon {
 
     class Species;
-    class Move;
     class Item;
 
     /*!
@@ -71,7 +72,7 @@ namespace OpMon {
         const Species *species;
         int level;
 
-        std::vector<Move *> moves;
+        std::array<Move, 4> moves;
 
         Nature nature;
 
@@ -108,7 +109,7 @@ namespace OpMon {
          * \param moves The OpMon's moves.
          */
         OpMon(const std::string &nickname, const Species *species, int level,
-              const std::vector<Move *> &moves, Nature nature);
+              const std::array<Move, 4> &moves, Nature nature);
 
         int getConfusedCD() const { return confusedCD; }
 
@@ -201,8 +202,8 @@ namespace OpMon {
          * \param species The new species of the OpMon.
          * \param types The two new types of the OpMon.
          */
-        void setStats(int stats[], Move *moves[], const Species &species,
-                      Type types[]);
+        void setStats(int stats[], const std::array<Move, 4> &moves,
+                      const Species &species, Type types[]);
 
         /*!
          * \brief Makes the OpMon loose HP.
@@ -274,7 +275,16 @@ namespace OpMon {
 
         int getLevel() const { return level; }
 
-        std::vector<Move *> getMoves() { return moves; }
+        std::array<Move, 4> &getMoves() { return moves; }
+
+        /*!
+         * \brief Returns a pointer to one of the OpMon's moves.
+         * \param index The index of the move, between 0 and 3.
+         * \returns `nullptr` if the move slot is empty.
+         */
+        Move *getMove(int index) {
+            return moves[index].isEmpty() ? nullptr : &moves[index];
+        }
 
         int getStatEVA() const { return statEVA; }
 
@@ -307,6 +317,27 @@ namespace OpMon {
         const Species &getSpecies() const { return *species; }
 
         Item *itemHeld() const { return held; }
+
+        Nature getNature() const { return nature; }
+
+        /*!
+         * \brief The values specific to an OpMon which aren't given to its constructor.
+         * \details Used to save an OpMon. The IV and EV are in the order ATK, DEF, ATKSPE, DEFSPE, SPE, HP.
+         */
+        struct Individual {
+            std::array<int, 6> ivs;
+            std::array<int, 6> evs;
+            int exp;
+            int hp;
+            Status status;
+        };
+
+        Individual getIndividual() const;
+
+        /*!
+         * \brief Restores the values returned by getIndividual(), and recalculates the stats.
+         */
+        void setIndividual(Individual const &values);
     };
 
 } // namespace OpMon
@@ -46,6 +46,13 @@ namespace OpMon {
         return toReturn;
     }
 
+    void OpTeam::clear() {
+        for(OpMon *op : opteam) {
+            delete(op);
+        }
+        opteam.clear();
+    }
+
     OpMon *OpTeam::operator[](int id) const { return opteam[id]; }
 
     bool OpTeam::isKo() const {
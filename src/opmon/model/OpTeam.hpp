@@ -51,6 +51,11 @@ namespace OpMon {
          * \brief Returns `true` if all the OpMon on the team are K.O.
          */
         bool isKo() const;
+
+        /*!
+         * \brief Deletes all the OpMon of the team.
+         */
+        void clear();
         int getSize() const;
         void save();
 
@@ -16,7 +16,7 @@ namespace OpMon {
 
     GameStatus AnimationCtrl::update(sf::RenderTexture &frame) {
         GameStatus status = view->update();
-        frame.draw(*view);
+        drawView(frame, *view);
         return status;
     }
 } // namespace OpMon
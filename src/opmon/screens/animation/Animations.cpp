@@ -8,40 +8,90 @@
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
 #include <cstddef>
 
 #include "src/opmon/core/GameStatus.hpp"
+#include "src/opmon/view/ui/Window.hpp"
 #include "src/utils/ResourceLoader.hpp"
+#include "src/utils/time.hpp"
 
 namespace OpMon {
 
     namespace Animations {
 
-        // While false, the "WinAnim" animation's sprites are not loaded
-        bool WinAnim::winInit = false;
-        // Array used by "WinAnim"
-        sf::Texture WinAnim::fen[6];
+        namespace {
+            /*!
+             * \brief The number of textures of WinAnim.
+             */
+            constexpr unsigned int WIN_FRAMES = 6;
+            /*!
+             * \brief The time each texture of WinAnim is shown, in milliseconds.
+             */
+            constexpr int WIN_FRAME_DURATION = 1000 / Ui::Window::FRAMERATE;
 
-        Animation::Animation(sf::Texture bgTxt, sf::Texture after)
-            : bgTxt(bgTxt), afterTx(after) {}
+            Ui::Timeline winTimeline(bool order) {
+                std::vector<std::shared_ptr<const sf::Texture>> frames;
+                Utils::ResourceLoader::loadSharedArray(
+                    frames, "animations/winChange/animWindowFrame%d.png",
+                    WIN_FRAMES, 1);
+                Ui::Track track {Ui::TrackProperty::FRAME, {}};
+                for(unsigned int i = 0; i <= WIN_FRAMES; i++) {
+                    float frame = std::min(i, WIN_FRAMES - 1);
+                    track.keyframes.push_back(
+                        {int(i) * WIN_FRAME_DURATION,
+                         {order ? frame : WIN_FRAMES - 1 - frame},
+                         Ui::Easing::STEP});
+                }
+                return Ui::Timeline({track}, std::move(frames));
+            }
 
-        WinAnim::WinAnim(sf::Texture const &bgTxt, bool order)
-            : Animation(bgTxt), order(order) {
-            if(!winInit) {
-                winInit = true;
-                Utils::ResourceLoader::loadTextureArray(
-                    fen, "animations/winChange/animWindowFrame%d.png", 6, 1);
+            Ui::Timeline wooshTimeline(WooshDir dir, int duration,
+                                       bool outToIn) {
+                sf::Vector2f move;
+                switch(dir) {
+                    case WooshDir::UP:
+                        move = sf::Vector2f(0, -512);
+                        break;
+                    case WooshDir::DOWN:
+                        move = sf::Vector2f(0, 512);
+                        break;
+                    case WooshDir::LEFT:
+                        move = sf::Vector2f(-512, 0);
+                        break;
+                    case WooshDir::RIGHT:
+                        move = sf::Vector2f(512, 0);
+                        break;
+                }
+                sf::Vector2f start = outToIn ? -move : sf::Vector2f(0, 0);
+                sf::Vector2f end = start + move;
+                return Ui::Timeline({{Ui::TrackProperty::POSITION,
+                                      {{0, {start.x, start.y}},
+                                       {duration, {end.x, end.y}}}}});
             }
-        }
+        } // namespace
 
-        GameStatus WinAnim::update() {
+        Animation::Animation(sf::Texture const &bgTxt, Ui::Timeline timeline)
+            : bgTxt(bgTxt), timeline(std::move(timeline)) {
             bgSpr.setTexture(bgTxt);
-            anim.setTexture(fen[(order ? counter : (frames - counter))]);
-            counter++;
-            return (counter > frames) ? GameStatus::PREVIOUS_NLS :
-                                        GameStatus::CONTINUE;
+            this->timeline.apply(anim, 0);
         }
 
+        GameStatus Animation::update() {
+            int now = Utils::Time::getGameMilliseconds();
+            if(startTime < 0) {
+                startTime = now;
+            }
+            int elapsed = now - startTime;
+            timeline.apply(anim, elapsed);
+            return (elapsed >= timeline.getDuration()) ?
+                       GameStatus::PREVIOUS_NLS :
+                       GameStatus::CONTINUE;
+        }
+
+        WinAnim::WinAnim(sf::Texture const &bgTxt, bool order)
+            : Animation(bgTxt, winTimeline(order)) {}
+
         void WinAnim::draw(sf::RenderTarget &frame,
                            sf::RenderStates states) const {
             frame.draw(bgSpr);
@@ -51,38 +101,8 @@ namespace OpMon {
         WooshAnim::WooshAnim(sf::Texture const &before,
                              sf::Texture const &after, WooshDir dir,
                              int duration, bool outToIn)
-            : Animation(before, after),
-              dir(dir),
-              duration(duration),
-              outToIn(outToIn) {
-            counter = duration;
-            if(outToIn) {
-                initialPos[(int)WooshDir::DOWN] = sf::Vector2f(0, -512);
-                initialPos[(int)WooshDir::UP] = sf::Vector2f(0, 512);
-                initialPos[(int)WooshDir::RIGHT] = sf::Vector2f(-512, 0);
-                initialPos[(int)WooshDir::LEFT] = sf::Vector2f(512, 0);
-            } else {
-                for(size_t i = 0; i < 4; i++)
-                    initialPos[i] = sf::Vector2f(0, 0);
-            }
-            mvDir[(int)WooshDir::DOWN] = sf::Vector2f(0, 1);
-            mvDir[(int)WooshDir::UP] = sf::Vector2f(0, -1);
-            mvDir[(int)WooshDir::RIGHT] = sf::Vector2f(1, 0);
-            mvDir[(int)WooshDir::LEFT] = sf::Vector2f(-1, 0);
-
-            this->bgSpr.setPosition(0, 0);
-            this->bgSpr.setTexture(before);
-
+            : Animation(before, wooshTimeline(dir, duration, outToIn)) {
             this->anim.setTexture(after);
-            this->anim.setPosition(initialPos[(int)dir]);
-        }
-
-        GameStatus WooshAnim::update() {
-            anim.move((counter == 0) ? sf::Vector2f(0, 0) :
-                                       (mvDir[(int)dir] * (512.0f / duration)));
-            counter--;
-            return (counter < 0) ? GameStatus::PREVIOUS_NLS :
-                                   GameStatus::CONTINUE;
         }
 
         void WooshAnim::draw(sf::RenderTarget &frame,
@@ -18,6 +18,7 @@
 #include <iostream>
 
 #include "src/opmon/core/GameStatus.hpp"
+#include "src/opmon/view/ui/Timeline.hpp"
 #include "src/utils/defines.hpp"
 
 namespace sf {
@@ -31,11 +32,11 @@ namespace OpMon {
     namespace Animations {
 
         /*!
-         * \brrief Base class defining an animation on the whole screen.
+         * \brief Base class defining an animation on the whole screen.
+         * \details The animated sprite follows a Ui::Timeline, evaluated with the game time elapsed since the first update: the animation lasts the same time whatever the framerate.
          */
         class Animation : public sf::Drawable {
           protected:
-            int counter = 0;
             /*!
              * \brief The sprite of the animation.
              */
@@ -47,22 +48,29 @@ namespace OpMon {
             /*!
              * \brief The texture of the background.
              */
-            sf::Texture bgTxt;
+            sf::Texture const &bgTxt;
             /*!
-             * \brief The texture to show after the animation.
+             * \brief The animation of Animation::anim.
              */
-            sf::Texture afterTx;
+            Ui::Timeline timeline;
+            /*!
+             * \brief The game time of the first update, in milliseconds. -1 before the first update.
+             */
+            int startTime = -1;
 
           public:
             /*!
              * \brief Constructs an animation.
-             * \param before The texture present before the animation.
-             * \param after The texture to show after the animation.
-             * \details For classic animations, "before" is enough. "after" is used for transitions.
+             * \param before The texture present before the animation. It isn't copied, and must be kept until the end of the animation.
+             * \param timeline The animation of the sprite.
              */
-            Animation(sf::Texture before, sf::Texture after = sf::Texture());
+            Animation(sf::Texture const &before, Ui::Timeline timeline);
             virtual ~Animation() = default;
-            virtual GameStatus update() = 0;
+            /*!
+             * \brief Updates the sprite to the current time of the animation.
+             * \returns GameStatus::PREVIOUS_NLS when the animation has ended, GameStatus::CONTINUE otherwise.
+             */
+            virtual GameStatus update();
             /*!
              * \brief Updates the animation.
              * \deprecated Use update() and then sf::RenderTexture::draw(sf::Drawable).
@@ -79,25 +87,12 @@ namespace OpMon {
          * \brief Animation played as a transition between the professor's dialog and the name input screen.
          */
         class WinAnim : public Animation {
-          private:
-            int frames {5};
-            /*!
-             * \brief The order of the animation.
-             * \details If `true` : Opening movement, closing movement otherwise.
-             */
-            bool order;
-            /*!
-             * \brief If `true`, the textures for the animation has been loaded.
-             */
-            static bool winInit;
+          public:
             /*!
-             * \brief The textures for the animation.
+             * \param bgTxt The texture present before the animation.
+             * \param order If `true` : Opening movement, closing movement otherwise.
              */
-            static sf::Texture fen[6];
-
-          public:
             WinAnim(sf::Texture const &bgTxt, bool order);
-            virtual GameStatus update() override;
             void draw(sf::RenderTarget &frame, sf::RenderStates state) const;
         };
 
@@ -116,44 +111,18 @@ namespace OpMon {
          * \details This animation makes a sprite move by one entire screen (512px), either from the outside of the screen to the screen, or the opposite. In the game, this animation is used for the in-game menu.
          */
         class WooshAnim : public Animation {
-          private:
-            /*!
-             * \brief The direction of the movement.
-             */
-            WooshDir dir;
-            /*!
-             * \brief The duration of the animation, in frames.
-             */
-            int duration = 15;
-            /*!
-             * \brief The initial position of the sprite to move.
-             */
-            sf::Vector2f initialPos[4];
-            /*!
-             * \brief The direction of the movement in a vector.
-             * \details The vector is filled according to WooshAnim::dir with 1, 0 or -1.
-             * \todo Put this in const static and initilise it only one time.
-             */
-            sf::Vector2f mvDir[4];
-            /*!
-             * \brief The initial position of the mobile sprite.
-             * \details If `true`, the sprite will be outside the screen at the start, in a different position according to the direction it has to move. Else, the initial position will be 0,0 and the sprite will move outside the screen.
-             */
-            bool outToIn;
-
           public:
             /*!
              * \brief Constructs a WooshAnim.
-             * \param before The static texture, in the background. It won't move.
-             * \param after The mobile texture.
+             * \param before The static texture, in the background. It won't move. It must be kept until the end of the animation.
+             * \param after The mobile texture. It must be kept until the end of the animation.
              * \param dir The direction of the movement.
-             * \param duraction The duration of the movement, in frames.
-             * \param outToIn The initial position of the mobile sprite.
+             * \param duration The duration of the movement, in milliseconds.
+             * \param outToIn The initial position of the mobile sprite. If `true`, the sprite will be outside the screen at the start, in a different position according to the direction it has to move. Else, the initial position will be 0,0 and the sprite will move outside the screen.
              */
             WooshAnim(sf::Texture const &before, sf::Texture const &after,
-                      WooshDir dir, int duration = 15, bool outToIn = true);
+                      WooshDir dir, int duration = 500, bool outToIn = true);
 
-            GameStatus update();
             void draw(sf::RenderTarget &frame, sf::RenderStates state) const;
         };
 
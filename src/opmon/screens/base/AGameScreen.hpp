@@ -21,6 +21,9 @@
 #include <memory>
 
 #include "../../core/GameStatus.hpp"
+#include "src/utils/FrameMetrics.hpp"
+#include "src/utils/LoadingProgress.hpp"
+#include "src/utils/Profiler.hpp"
 
 namespace OpMon {
 
@@ -54,12 +57,27 @@ namespace OpMon {
          */
         virtual GameStatus update(sf::RenderTexture &frame) = 0;
 
+        /*!
+         * \brief Returns `true` if the screen changes even without any event.
+         * \details When it returns `false`, GameLoop only calls update() after an event and skips the drawing and the refresh of the window in the other frames. Screens which only react to the player's input, like the menus, override it to return `false` while nothing is animated.
+         */
+        virtual bool isDirty() const { return true; }
+
         virtual void suspend() {};
         virtual void resume() {};
 
+        /*!
+         * \brief Prepares the loading of the next screen in a worker thread.
+         * \details Method called by Gameloop in a worker thread when the status returned is GameStatus::NEXT, while the loading screen is shown. loadNextScreen() is called in the main thread once it returns. It must not use the graphics context: it is used to read the files and decode the images (see Utils::ResourceLoader::preloadImage()), so that loadNextScreen() only has to send them to the graphics card.
+         * \param progress The progress of the preparation, shown on the loading screen.
+         */
+        virtual void prepareNextScreen(Utils::LoadingProgress &progress) {
+            (void)progress;
+        };
+
         /*!
          * \brief Loads the next screen.
-         * \details Method called by Gameloop when the status returned is GameStatus::NEXT. It loads the next screen in _next_gs
+         * \details Method called by Gameloop when the status returned is GameStatus::NEXT, after prepareNextScreen(). It loads the next screen in _next_gs
          */
         virtual void loadNextScreen() {};
 
@@ -72,6 +90,16 @@ namespace OpMon {
          * \brief The next screen, loaded after loadNextScreen has been called.
          */
         std::unique_ptr<AGameScreen> _next_gs;
+
+        /*!
+         * \brief Draws the view of the screen on the frame, counting the time spent in the DRAW phase of Utils::FrameMetrics.
+         */
+        static void drawView(sf::RenderTarget &frame,
+                             sf::Drawable const &view) {
+            Utils::FrameMetrics::Scope scope(Utils::FrameMetrics::DRAW);
+            OPMON_PROFILE_ZONE("draw");
+            frame.draw(view);
+        }
     };
 
 } // namespace OpMon
@@ -29,12 +29,16 @@
 #include "src/opmon/view/ui/Jukebox.hpp"
 #include "src/utils/CycleCounter.hpp"
 #include "src/utils/OpString.hpp"
+#include "src/utils/Profiler.hpp"
 #include "src/utils/StringKeys.hpp"
+#include "src/utils/TextLayout.hpp"
 #include "src/utils/defines.hpp"
+#include "src/utils/time.hpp"
 
 namespace OpMon {
 
     void Battle::draw(sf::RenderTarget &frame, sf::RenderStates states) const {
+        OPMON_PROFILE_ZONE("Battle::draw");
         frame.setView(frame.getDefaultView());
 
         frame.draw(background);
@@ -114,6 +118,7 @@ namespace OpMon {
                               Elements::TurnData const &defTurn,
                               std::queue<Elements::TurnAction> &actionQueue,
                               bool *turnActivated, bool atkFirst) {
+        OPMON_PROFILE_ZONE("Battle::update");
         drawDialog = false;
         drawMainDialog = false;
         drawMoves = false;
@@ -235,6 +240,7 @@ namespace OpMon {
                              Elements::TurnActionType::ATK_STAT_MOD) ?
                                 &atkTr :
                                 &defTr);
+                        opAnimStart = Utils::Time::getGameMilliseconds();
                     }
 
                     // Dialog part
@@ -261,7 +267,8 @@ namespace OpMon {
                     }
 
                     // Checking part
-                    if(!currentOpAnims->front().apply() &&
+                    if(!currentOpAnims->front().apply(
+                           Utils::Time::getGameMilliseconds() - opAnimStart) &&
                        dialog->isDialogOver()) { // If the dialog is over, go to
                                                  // the next action in the queue
                         actionQueue.pop();
@@ -327,8 +334,10 @@ namespace OpMon {
                               (turnNber == 1))) /* Is it player's turn */ ?
                                 &atkTr :
                                 &defTr);
+                        opAnimStart = Utils::Time::getGameMilliseconds();
                     }
-                    if(!currentOpAnims->front().apply()) {
+                    if(!currentOpAnims->front().apply(
+                           Utils::Time::getGameMilliseconds() - opAnimStart)) {
                         currentOpAnims->pop();
                         actionQueue.pop();
                         if(currentOpAnims->empty()) {
@@ -353,13 +362,11 @@ namespace OpMon {
             drawDialog = true;
 
         } else if(!moveChoice) { // Main battle menu
-            std::queue<sf::String> waitTxt = Utils::StringKeys::autoNewLine(
-                data.getGameDataPtr()->getString("battle.wait"),
-                data.getGameDataPtr()->getFont(), 22, 192);
-            sf::String str = waitTxt.front() + sf::String('\n');
-            waitTxt.pop();
-            str += waitTxt.front();
-            waitText.setString(str);
+            const std::vector<sf::String> &waitTxt =
+                Utils::TextLayout::get(data.getGameDataPtr()->getFont(), 22)
+                    .wrap(data.getGameDataPtr()->getStringKeys(),
+                          "battle.wait", 192);
+            waitText.setString(waitTxt[0] + sf::String('\n') + waitTxt[1]);
             drawMainDialog = true;
             cursor.setPosition(
                 posChoices[curPos.getValue()] +
@@ -372,8 +379,8 @@ namespace OpMon {
         } else { // Moves menu
 
             for(unsigned int i = 0; i < 4; i++) {
-                if(atkTurn.opmon->getMoves()[i] != nullptr) {
-                    moves[i].setString(atkTurn.opmon->getMoves()[i]->getName());
+                if(atkTurn.opmon->getMove(i) != nullptr) {
+                    moves[i].setString(atkTurn.opmon->getMove(i)->getName());
                 } else {
                     moves[i].setString(
                         "----"); // Text to print if there is no move
@@ -381,28 +388,21 @@ namespace OpMon {
                 drawMoves = true;
             }
 
-            if(atkTurn.opmon->getMoves()[curPos.getValue()] != nullptr) {
+            Move *curMove = atkTurn.opmon->getMove(curPos.getValue());
+            if(curMove != nullptr) {
                 // Changes the text's color according to the number of PP left
-                if(atkTurn.opmon->getMoves()[curPos.getValue()]->getPP() <=
-                       (atkTurn.opmon->getMoves()[curPos.getValue()]
-                            ->getPPMax() /
-                        5) &&
-                   atkTurn.opmon->getMoves()[curPos.getValue()]->getPP() > 0) {
+                if(curMove->getPP() <= (curMove->getPPMax() / 5) &&
+                   curMove->getPP() > 0) {
                     ppTxt.setSfmlColor(sf::Color::Yellow);
-                } else if(atkTurn.opmon->getMoves()[curPos.getValue()]
-                              ->getPP() == 0) {
+                } else if(curMove->getPP() == 0) {
                     ppTxt.setSfmlColor(sf::Color::Red);
                 } else {
                     ppTxt.setSfmlColor(sf::Color::Black);
                 }
-                ppTxt.setString(
-                    std::to_string(
-                        atkTurn.opmon->getMoves()[curPos.getValue()]->getPP()) +
-                    " / " +
-                    std::to_string(atkTurn.opmon->getMoves()[curPos.getValue()]
-                                       ->getPPMax()));
+                ppTxt.setString(std::to_string(curMove->getPP()) + " / " +
+                                std::to_string(curMove->getPPMax()));
                 type.setTexture(data.getGameDataPtr()->getTypeTexture(
-                    atkTurn.opmon->getMoves()[curPos.getValue()]->getType()));
+                    curMove->getType()));
                 drawType = true;
             } else { // If there is no move, print this
                 ppTxt.setSfmlColor(sf::Color::Red);
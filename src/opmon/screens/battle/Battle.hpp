@@ -74,6 +74,10 @@ namespace OpMon {
          * \brief The current queue of OpMon animations.
          */
         std::queue<Ui::Transformation> *currentOpAnims = nullptr;
+        /*!
+         * \brief The game time at which the front animation of currentOpAnims has been attached, in milliseconds.
+         */
+        int opAnimStart = 0;
 
         /*!
          * \brief The HP of the front OpMon.
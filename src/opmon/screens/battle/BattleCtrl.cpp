@@ -24,6 +24,7 @@
 #include "src/opmon/view/elements/events/BattleEvent.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
 #include "src/utils/OpString.hpp"
+#include "src/utils/Profiler.hpp"
 #include "src/utils/misc.hpp"
 
 namespace OpMon {
@@ -31,15 +32,14 @@ namespace OpMon {
     class Species;
 
     BattleCtrl::BattleCtrl(OpTeam *one, Elements::BattleEvent *two,
-                           GameData *gamedata, Player *player)
-        : BattleCtrl(one, two->getOpTeam(), gamedata, player) {
+                           BattleData &data)
+        : BattleCtrl(one, two->getOpTeam(), data) {
         this->trainer = two;
         next.type = Elements::TurnActionType::NEXT;
     }
 
-    BattleCtrl::BattleCtrl(OpTeam *one, OpTeam *two, GameData *gamedata,
-                           Player *player)
-        : data(gamedata, player),
+    BattleCtrl::BattleCtrl(OpTeam *one, OpTeam *two, BattleData &data)
+        : data(data),
           playerTeam(one),
           trainerTeam(two),
           atk(one->getOp(0)),
@@ -52,7 +52,7 @@ namespace OpMon {
     GameStatus BattleCtrl::update(sf::RenderTexture &frame) {
         GameStatus returned = view.update(atkTurn, defTurn, actionsQueue,
                                           &turnActivated, atkFirst);
-        frame.draw(view);
+        drawView(frame, view);
         return returned;
     }
 
@@ -103,8 +103,7 @@ namespace OpMon {
                             // Gets the selected move, checks if it isn't a
                             // invalid move (PP check and existence check), and
                             // then launches the turn.
-                            atkTurn.moveUsed =
-                                atk->getMoves()[view.getCurPos()];
+                            atkTurn.moveUsed = atk->getMove(view.getCurPos());
                             if(atkTurn.moveUsed != nullptr) {
                                 if(atkTurn.moveUsed->getPP() > 0) {
                                     atkTurn.type = Elements::TurnType::MOVE;
@@ -193,7 +192,7 @@ namespace OpMon {
 #pragma GCC diagnostic ignored "-Wunused-parameter"
     // Unfinished method, the IA will be programmed in the future.
     Elements::TurnData *BattleCtrl::turnIA(int level) {
-        defTurn.moveUsed = def->getMoves()[0];
+        defTurn.moveUsed = def->getMove(0);
         defTurn.type = Elements::TurnType::MOVE;
         return &defTurn;
     }
@@ -213,6 +212,7 @@ namespace OpMon {
     }
 
     bool BattleCtrl::turn() {
+        OPMON_PROFILE_ZONE("BattleCtrl::turn");
         // These variables are used to check if the turn of one of the OpMons'
         // is over.
         bool atkDone = false;
@@ -280,7 +280,7 @@ namespace OpMon {
 #pragma GCC diagnostic ignored "-Wunused-parameter"
     bool BattleCtrl::canMove(OpMon *opmon, Elements::TurnData *opTurn) {
         bool canMove = true;
-        std::vector<sf::String *> opName(1);
+        std::vector<const sf::String *> opName(1);
         opName[0] = new sf::String(opmon->getNickname());
         // Checks if frozen
         if(opmon->getStatus() == Status::FROZEN) {
@@ -40,7 +40,10 @@ namespace OpMon {
      */
     class BattleCtrl : public AGameScreen {
       private:
-        BattleData data;
+        /*!
+         * \brief The data of the battles, kept by OverworldData between the battles.
+         */
+        BattleData &data;
 
         OpTeam *playerTeam;
         OpTeam *trainerTeam;
@@ -96,7 +99,7 @@ namespace OpMon {
          * \brief The moves of the currently fighting OpMons before entering the battle.
          * \details These moves are used to reset the moves after the battle.
          */
-        std::vector<Move *> oldMoves[2];
+        std::array<Move, 4> oldMoves[2];
 
         /*!
          * \brief `true` if the battle is in the turns phase.
@@ -167,20 +170,16 @@ namespace OpMon {
          * \brief Initialises a battle with two OpTeam.
          * \param one The player's team.
          * \param two The opponent's team.
-         * \param gamedata The GameData object.
-         * \param player The Player object.
+         * \param data The data of the battles. BattleData::load() must have been called.
          */
-        BattleCtrl(OpTeam *one, OpTeam *two, GameData *gamedata,
-                   Player *player);
+        BattleCtrl(OpTeam *one, OpTeam *two, BattleData &data);
         /*!
          * \brief Initialises a battle between the player and a trainer.
          * \param one The player's team.
          * \param two The opposite trainer.
-         * \param gamedata The GameData object.
-         * \param player The Player object.
+         * \param data The data of the battles. BattleData::load() must have been called.
          */
-        BattleCtrl(OpTeam *one, Elements::BattleEvent *two, GameData *gamedata,
-                   Player *player);
+        BattleCtrl(OpTeam *one, Elements::BattleEvent *two, BattleData &data);
         GameStatus checkEvent(sf::Event const &) override;
         GameStatus update(sf::RenderTexture &frame) override;
 
@@ -5,47 +5,126 @@
 */
 #include "BattleData.hpp"
 
+#include <chrono>
+#include <cstdlib>
+
 #include "src/utils/ResourceLoader.hpp"
 
 namespace OpMon {
     class Player;
     class GameData;
 
+    namespace {
+        /*!
+         * \brief The images of the battle screen.
+         */
+        enum Image {
+            BACKGROUND_GRASS,
+            DIALOG,
+            CURSOR,
+            CHARA_PLAYER,
+            CHARA_BETA,
+            INFOBOX_PLAYER,
+            INFOBOX_TRAINER,
+            HEALTHBAR_1,
+            HEALTHBAR_2,
+            SHADOW_PLAYER,
+            SHADOW_TRAINER,
+            MOVE_DIALOG,
+            IMAGE_COUNT
+        };
+
+        const char *const imagePaths[IMAGE_COUNT] = {
+            "backgrounds/battle_bkg/background_grass.png",
+            "backgrounds/dialog/battle_dialog.png",
+            "sprites/misc/arrBattle.png",
+            "sprites/chara/pp/pp_battle.png",
+            "sprites/chara/beta/beta_battle.png",
+            "sprites/battle/square_1.png",
+            "sprites/battle/square_2.png",
+            "sprites/battle/health_bar.png",
+            "sprites/battle/health_jauge.png",
+            "sprites/battle/shadow_2.png",
+            "sprites/battle/shadow_1.png",
+            "backgrounds/dialog/moves_dialog.png"};
+    } // namespace
+
     BattleData::BattleData(GameData *data, Player *player)
-        : gamedata(data), player(player) {
-        Utils::ResourceLoader::load(
-            backgrounds["grass"],
-            "backgrounds/battle_bkg/background_grass.png");
-        Utils::ResourceLoader::load(dialog,
-                                    "backgrounds/dialog/battle_dialog.png");
+        : gamedata(data), player(player) {}
+
+    void BattleData::warmUp() {
+        if(loaded) {
+            return;
+        }
+        if(!preloading.valid()) {
+            preloading =
+                std::async(std::launch::async, &BattleData::preloadImages);
+        } else if(preloading.wait_for(std::chrono::seconds(0)) ==
+                  std::future_status::ready) {
+            load();
+        }
+    }
+
+    void BattleData::warmUpNear(sf::Vector2i const &eventPosition,
+                                sf::Vector2i const &playerPosition) {
+        sf::Vector2i distance = eventPosition - playerPosition;
+        if(std::abs(distance.x) + std::abs(distance.y) <= WARM_UP_DISTANCE) {
+            warmUp();
+        }
+    }
 
-        Utils::ResourceLoader::load(cursor, "sprites/misc/arrBattle.png");
+    void BattleData::preloadImages() {
+        for(const char *path : imagePaths) {
+            Utils::ResourceLoader::preloadImage(path);
+        }
+    }
+
+    void BattleData::preload() {
+        if(loaded) {
+            return;
+        }
+        if(preloading.valid()) {
+            preloading.wait();
+        } else {
+            preloadImages();
+        }
+    }
+
+    void BattleData::load() {
+        if(loaded) {
+            return;
+        }
+        // Waits for the images decoded by warmUp()
+        if(preloading.valid()) {
+            preloading.get();
+        }
+
+        Utils::ResourceLoader::load(backgrounds["grass"],
+                                    imagePaths[BACKGROUND_GRASS]);
+        Utils::ResourceLoader::load(dialog, imagePaths[DIALOG]);
+
+        Utils::ResourceLoader::load(cursor, imagePaths[CURSOR]);
 
         charaBattleTextures["player"].push_back(sf::Texture());
         Utils::ResourceLoader::load(charaBattleTextures["player"][0],
-                                    "sprites/chara/pp/pp_battle.png");
+                                    imagePaths[CHARA_PLAYER]);
         // charaBattleTextures["cyrielle"].push_back(sf::Texture());
         // Utils::ResourceLoader::load(charaBattleTextures["cyrielle"][0],
         // "sprites/chara/cyrielle/cyrielle_battle.png");
         charaBattleTextures["beta"].push_back(sf::Texture());
         Utils::ResourceLoader::load(charaBattleTextures["beta"][0],
-                                    "sprites/chara/beta/beta_battle.png");
+                                    imagePaths[CHARA_BETA]);
         battlePlayerAnim.push_back(charaBattleTextures["player"][0]);
-        Utils::ResourceLoader::load(infoboxPlayer,
-                                    "sprites/battle/square_1.png");
+        Utils::ResourceLoader::load(infoboxPlayer, imagePaths[INFOBOX_PLAYER]);
         Utils::ResourceLoader::load(infoboxTrainer,
-                                    "sprites/battle/square_2.png");
-        Utils::ResourceLoader::load(healthbar1,
-                                    "sprites/battle/health_bar.png");
-        Utils::ResourceLoader::load(healthbar2,
-                                    "sprites/battle/health_jauge.png");
-        Utils::ResourceLoader::load(shadowPlayer,
-                                    "sprites/battle/shadow_2.png");
-        Utils::ResourceLoader::load(shadowTrainer,
-                                    "sprites/battle/shadow_1.png");
-
-        Utils::ResourceLoader::load(moveDialog,
-                                    "backgrounds/dialog/moves_dialog.png");
+                                    imagePaths[INFOBOX_TRAINER]);
+        Utils::ResourceLoader::load(healthbar1, imagePaths[HEALTHBAR_1]);
+        Utils::ResourceLoader::load(healthbar2, imagePaths[HEALTHBAR_2]);
+        Utils::ResourceLoader::load(shadowPlayer, imagePaths[SHADOW_PLAYER]);
+        Utils::ResourceLoader::load(shadowTrainer, imagePaths[SHADOW_TRAINER]);
+
+        Utils::ResourceLoader::load(moveDialog, imagePaths[MOVE_DIALOG]);
+        loaded = true;
     }
 
 } // namespace OpMon
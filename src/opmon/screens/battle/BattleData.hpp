@@ -5,6 +5,8 @@
  */
 #pragma once
 
+#include <SFML/System/Vector2.hpp>
+#include <future>
 #include <list>
 
 #include "src/opmon/core/GameData.hpp"
@@ -16,6 +18,7 @@ namespace OpMon {
 
     /*!
      * \brief Contains the data used by View::Battle and Controller::BattleCtrl
+     * \details The data is owned by OverworldData and kept between the battles, so the textures are only loaded once. They are loaded by load() at the beginning of the first battle, or before if warmUp() is called when a battle is about to start.
      */
     class BattleData {
       private:
@@ -36,6 +39,20 @@ namespace OpMon {
         GameData *gamedata;
         Player *player;
 
+        /*!
+         * \brief `true` if the textures have been loaded.
+         */
+        bool loaded = false;
+        /*!
+         * \brief The decoding of the images in another thread, launched by warmUp().
+         */
+        std::future<void> preloading;
+
+        /*!
+         * \brief Decodes the images of the textures (see Utils::ResourceLoader::preloadImage()).
+         */
+        static void preloadImages();
+
         /*!
          * \brief The copy constructor. Not defined, must not be used.
          */
@@ -57,12 +74,44 @@ namespace OpMon {
         GameData *getGameDataPtr() { return gamedata; }
 
         /*!
-         * \brief Initialises all the data.
+         * \brief Initialises the data. The textures are loaded later, by load() or warmUp().
          * \param data A pointer to the GameData object.
          * \param player A pointer to the Player object.
          */
         BattleData(GameData *data, Player *player);
 
+        /*!
+         * \brief The distance, in squares, from which a battle event warms up the data (see warmUpNear()).
+         */
+        static constexpr int WARM_UP_DISTANCE = 6;
+
+        /*!
+         * \brief Decodes the images of the textures, or waits for their decoding if warmUp() has started it.
+         * \details Doesn't use the graphics context, so it can be called from a worker thread (see AGameScreen::prepareNextScreen()). Does nothing if the textures are loaded.
+         */
+        void preload();
+
+        /*!
+         * \brief Loads the textures, if it hasn't been done yet. Must be called before a battle.
+         */
+        void load();
+
+        /*!
+         * \brief Prepares the textures before a battle without blocking.
+         * \details Called at each frame while a battle may start soon. The first call decodes the images in another thread, and the first call after the end of the decoding sends them to the graphics card, so that load() has nothing left to do when the battle starts.
+         */
+        void warmUp();
+
+        /*!
+         * \brief Calls warmUp() if the player is at most WARM_UP_DISTANCE squares away from the event.
+         * \param eventPosition The position of the battle event, in squares.
+         * \param playerPosition The position of the player, in squares.
+         */
+        void warmUpNear(sf::Vector2i const &eventPosition,
+                        sf::Vector2i const &playerPosition);
+
+        bool isLoaded() const { return loaded; }
+
         /*!
          * \brief Gets one battle background.
          * \param id The identifier of the wanted background.
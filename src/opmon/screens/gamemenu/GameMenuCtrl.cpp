@@ -10,6 +10,7 @@ File under GNU GPL v3.0 license
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <memory>
+#include <utility>
 
 #include "GameMenu.hpp"
 #include "GameMenuData.hpp"
@@ -30,8 +31,9 @@ namespace OpMon {
 
     GameMenuCtrl::~GameMenuCtrl() {}
 
-    GameMenuCtrl::GameMenuCtrl(GameMenuData &data, Player &player)
-        : data(data), view(data), player(player) {}
+    GameMenuCtrl::GameMenuCtrl(GameMenuData &data, Player &player,
+                               std::shared_ptr<const SaveGame::State> save)
+        : data(data), view(data), player(player), save(std::move(save)) {}
 
     GameStatus GameMenuCtrl::checkEvent(sf::Event const &event) {
         switch(event.type) {
@@ -78,7 +80,7 @@ namespace OpMon {
     }
 
     GameStatus GameMenuCtrl::update(sf::RenderTexture &frame) {
-        frame.draw(view);
+        drawView(frame, view);
         return GameStatus::CONTINUE;
     }
 
@@ -86,7 +88,7 @@ namespace OpMon {
         switch(submenuToLoadNext) {
             case SubMenu::SAVE_MENU:
                 _next_gs = std::make_unique<SaveMenuCtrl>(
-                    data.getGameDataPtr(), SaveMenuContext::SAVING);
+                    data.getGameDataPtr(), SaveMenuContext::SAVING, save);
                 break;
             case SubMenu::SETTINGS_MENU:
                 _next_gs =
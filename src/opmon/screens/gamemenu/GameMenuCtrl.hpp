@@ -6,6 +6,7 @@
 #pragma once
 
 #include "GameMenu.hpp"
+#include "src/opmon/core/SaveGame.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
 #include "src/utils/CycleCounter.hpp"
 
@@ -28,6 +29,11 @@ namespace OpMon {
         GameMenu view;
         Player &player;
 
+        /*!
+         * \brief The state of the game when the menu has been opened, saved by the save menu.
+         */
+        std::shared_ptr<const SaveGame::State> save;
+
         /*!
          * \brief Determines which screen has to be loaded in loadNextScreen().
          *
@@ -46,10 +52,15 @@ namespace OpMon {
       public:
         ~GameMenuCtrl();
 
-        GameMenuCtrl(GameMenuData &data, Player &player);
+        GameMenuCtrl(GameMenuData &data, Player &player,
+                     std::shared_ptr<const SaveGame::State> save);
 
         GameStatus checkEvent(sf::Event const &event) override;
         GameStatus update(sf::RenderTexture &frame) override;
+        /*!
+         * \brief The menu only changes when a key is pressed.
+         */
+        bool isDirty() const override { return false; }
 
         void loadNextScreen() override;
         void suspend() override;
@@ -14,10 +14,6 @@ namespace OpMon {
 
     GameMenuData::GameMenuData(GameData *data, Player *player)
         : gamedata(data), player(player) {
-        Utils::ResourceLoader::load(menuTexture, "backgrounds/menu.png");
-        Utils::ResourceLoader::loadTextureArray(
-            selectionTexture, "backgrounds/menuS%d.png", 6, 1);
-
         selectionPos[0] = sf::Vector2f(106, 77);
         selectionPos[1] = sf::Vector2f(252, selectionPos[0].y);
         selectionPos[2] =
@@ -29,4 +25,16 @@ namespace OpMon {
         selectionPos[5] = sf::Vector2f(selectionPos[1].x, selectionPos[4].y);
     }
 
+    void GameMenuData::preloadImages() {
+        Utils::ResourceLoader::preloadImage("backgrounds/menu.png");
+        Utils::ResourceLoader::preloadImageArray("backgrounds/menuS%d.png", 6,
+                                                 1);
+    }
+
+    void GameMenuData::loadTextures() {
+        Utils::ResourceLoader::load(menuTexture, "backgrounds/menu.png");
+        Utils::ResourceLoader::loadTextureArray(
+            selectionTexture, "backgrounds/menuS%d.png", 6, 1);
+    }
+
 } // namespace OpMon
@@ -18,7 +18,7 @@ namespace OpMon {
     class GameMenuData {
       private:
         sf::Texture menuTexture;
-        sf::Texture background;
+        sf::Texture const *background = nullptr;
 
         sf::Texture selectionTexture[6];
         sf::Vector2f selectionPos[6];
@@ -33,12 +33,23 @@ namespace OpMon {
 
       public:
         /*!
-         * \brief Initialises all the data.
+         * \brief Initialises all the data, except the textures.
+         * \details Doesn't use the graphics context, see loadTextures().
          * \param data A pointer to the GameData object.
          * \param player A pointer to the Player object.
          */
         GameMenuData(GameData *data, Player *player);
 
+        /*!
+         * \brief Decodes the images of the textures (see Utils::ResourceLoader::preloadImage()). Can be called from another thread.
+         */
+        static void preloadImages();
+
+        /*!
+         * \brief Loads the textures. Must be called from the main thread, before using the menu.
+         */
+        void loadTextures();
+
         /*!
          * \brief Gets the background texture of the in-game menu.
          */
@@ -46,13 +57,13 @@ namespace OpMon {
         /*!
          * \brief Gets the last saved background by GameMenuData::setBackground for the open/close animations.
          */
-        sf::Texture &getBackground() { return background; }
+        sf::Texture const &getBackground() { return *background; }
         /*!
-         * \brief Saves given texture, can be retreived with GameMenuData::getBackground.
-         * \details This method is made to be used for the open/close animations of the menu. The texture to be saved here should be the current screen before the menu opens.
+         * \brief Saves a reference to the given texture, can be retreived with GameMenuData::getBackground.
+         * \details This method is made to be used for the open/close animations of the menu. The texture to be saved here should be the current screen before the menu opens. The texture isn't copied, so it must be kept while the menu is open.
          * \param bg The texture to save.
          */
-        void setBackground(sf::Texture const &bg) { background = bg; }
+        void setBackground(sf::Texture const &bg) { background = &bg; }
 
         /*!
          * \brief Gets the texture of a currently selected button.
@@ -68,7 +68,8 @@ namespace OpMon {
 
         // Init loop 0
         dialog = std::make_unique<Ui::Dialog>(
-            data.getGameDataPtr()->getString("prof.dialog.start.1"),
+            Utils::OpString(data.getGameDataPtr()->getStringKeys(),
+                            "prof.dialog.start.1"),
             data.getGameDataPtr());
     }
 
@@ -112,9 +113,7 @@ namespace OpMon {
     void IntroScene::delLoop1() {
         part++;
         // Init loop 2
-        dialog = std::make_unique<Ui::Dialog>(
-            txtP1.getString(data.getGameDataPtr()->getStringKeys()),
-            data.getGameDataPtr());
+        dialog = std::make_unique<Ui::Dialog>(txtP1, data.getGameDataPtr());
     }
 
     void IntroScene::draw(sf::RenderTarget &frame,
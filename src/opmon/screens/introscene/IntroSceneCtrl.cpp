@@ -10,8 +10,10 @@
 #include <SFML/System/String.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <future>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "IntroScene.hpp"
 #include "IntroSceneData.hpp"
@@ -21,6 +23,7 @@
 #include "src/opmon/screens/animation/Animations.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
 #include "src/opmon/screens/overworld/OverworldCtrl.hpp"
+#include "src/opmon/screens/overworld/OverworldData.hpp"
 #include "src/opmon/view/ui/Dialog.hpp"
 
 // Defines created to make the code easier to understand.
@@ -90,20 +93,34 @@ namespace OpMon {
         return GameStatus::CONTINUE;
     }
 
+    void IntroSceneCtrl::prepareNextScreen(Utils::LoadingProgress &progress) {
+        if(loadNext != LOAD_OVERWORLD) {
+            return;
+        }
+        overworldData = OverworldCtrl::prepareData(
+            data.getPlayer(), data.getGameDataPtr(), nullptr, progress);
+        // The images already decoded by the preloading have been skipped, but
+        // it must end before the images are used
+        if(overworldPreload.valid()) {
+            overworldPreload.get();
+        }
+    }
+
     void IntroSceneCtrl::loadNextScreen() {
         switch(loadNext) {
             case LOAD_OVERWORLD:
                 _next_gs = std::make_unique<OverworldCtrl>(
-                    data.getPlayer(), data.getGameDataPtr());
+                    data.getPlayer(), std::move(overworldData));
                 break;
             case LOAD_ANIMATION_OPEN:
                 _next_gs = std::make_unique<AnimationCtrl>(
-                    std::make_unique<Animations::WinAnim>(screenTexture, true));
+                    std::make_unique<Animations::WinAnim>(
+                        screenSnapshot->getTexture(), true));
                 break;
             case LOAD_ANIMATION_CLOSE:
                 _next_gs = std::make_unique<AnimationCtrl>(
-                    std::make_unique<Animations::WinAnim>(screenTexture,
-                                                          false));
+                    std::make_unique<Animations::WinAnim>(
+                        screenSnapshot->getTexture(), false));
                 break;
             default:
                 throw Utils::UnexpectedValueException(
@@ -117,21 +134,26 @@ namespace OpMon {
         // been set to true. This part will launch the animation.
         if(animNext) {
             animNext = false;
-            frame.draw(view);
+            drawView(frame, view);
             loadNext = LOAD_ANIMATION_CLOSE;
-            screenTexture = frame.getTexture();
+            screenSnapshot = data.getGameDataPtr()->window.snapshot();
+            overworldPreload = std::async(std::launch::async, [] {
+                Utils::LoadingProgress progress;
+                OverworldData::preloadResources(progress);
+            });
             return GameStatus::NEXT_NLS;
         }
         GameStatus toReturn = view.update();
         if(toReturn == GameStatus::CONTINUE) {
-            frame.draw(view);
+            drawView(frame, view);
         }
 
         if(toReturn == GameStatus::NEXT_NLS || toReturn == GameStatus::NEXT) {
             switch(view.getPart()) {
                 case 1:
                     loadNext = LOAD_ANIMATION_OPEN;
-                    screenTexture = frame.getTexture();
+                    screenSnapshot =
+                        data.getGameDataPtr()->window.snapshot();
                     toReturn = GameStatus::NEXT_NLS;
                     break;
                 case 3:
@@ -8,9 +8,12 @@
 #define STARTSCENECTRL_HPP
 
 #include <SFML/Window.hpp>
+#include <future>
+#include <memory>
 
 #include "IntroScene.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/opmon/screens/overworld/OverworldData.hpp"
 
 namespace sf {
     class Event;
@@ -52,15 +55,27 @@ namespace OpMon {
 
         /*!
          * \brief A screenshot.
-         * \details A screenshot of the frame is taken in update(sf::RenderTexture&). It is used as a background for the opening and closing animations before and after the input part of the introduction.
+         * \details A screenshot of the frame is taken in update(sf::RenderTexture&) when an animation starts (see Ui::Window::snapshot). It is used as a background for the opening and closing animations before and after the input part of the introduction.
          */
-        sf::Texture screenTexture;
+        std::shared_ptr<const sf::RenderTexture> screenSnapshot;
+
+        /*!
+         * \brief The preloading of the images of the overworld.
+         * \details Launched in another thread when the name input part ends, so that the images are decoded during the end of the introduction instead of on the loading screen.
+         */
+        std::future<void> overworldPreload;
+
+        /*!
+         * \brief The data of the overworld, prepared in prepareNextScreen() and given to OverworldCtrl in loadNextScreen().
+         */
+        std::unique_ptr<OverworldData> overworldData;
 
       public:
         IntroSceneCtrl(GameData *data);
         GameStatus checkEvent(sf::Event const &event) override;
         GameStatus update(sf::RenderTexture &frame) override;
 
+        void prepareNextScreen(Utils::LoadingProgress &progress) override;
         void loadNextScreen() override;
         void suspend() override;
         void resume() override;
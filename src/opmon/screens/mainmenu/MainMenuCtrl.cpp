@@ -72,7 +72,7 @@ namespace OpMon {
 
     GameStatus MainMenuCtrl::update(sf::RenderTexture &frame) {
         view.update(curPosI.getValue());
-        frame.draw(view);
+        drawView(frame, view);
         return GameStatus::CONTINUE;
     }
 
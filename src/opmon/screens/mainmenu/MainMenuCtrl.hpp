@@ -45,6 +45,10 @@ namespace OpMon {
 
         GameStatus checkEvent(sf::Event const &event) override;
         GameStatus update(sf::RenderTexture &frame) override;
+        /*!
+         * \brief The menu only changes when a key is pressed.
+         */
+        bool isDirty() const override { return false; }
 
         void loadNextScreen() override;
 
@@ -196,6 +196,7 @@ namespace OpMon {
         txtCtrlTalk.setCharacterSize(FONT_SIZE_DEFAULT - 4);
         txtCtrlInteract.setFont(data.getGameDataPtr()->getFont());
         txtCtrlInteract.setCharacterSize(FONT_SIZE_DEFAULT - 4);
+        initControlsValue();
 
         rectKeyChange.setTexture(data.getKeyChange());
         rectKeyChange.setScale(70 / rectKeyChange.getGlobalBounds().width,
@@ -351,30 +352,6 @@ namespace OpMon {
 
     GameStatus OptionsMenu::controlsLoop() {
         rectKeyChange.setPosition(posControls[currentKeyChange]);
-        txtCtrlUp.setString(data.getGameDataPtr()
-                                ->getOptions()
-                                .getParam("control.up")
-                                .getValue());
-        txtCtrlDown.setString(data.getGameDataPtr()
-                                  ->getOptions()
-                                  .getParam("control.down")
-                                  .getValue());
-        txtCtrlLeft.setString(data.getGameDataPtr()
-                                  ->getOptions()
-                                  .getParam("control.left")
-                                  .getValue());
-        txtCtrlRight.setString(data.getGameDataPtr()
-                                   ->getOptions()
-                                   .getParam("control.right")
-                                   .getValue());
-        txtCtrlTalk.setString(data.getGameDataPtr()
-                                  ->getOptions()
-                                  .getParam("control.talk")
-                                  .getValue());
-        txtCtrlInteract.setString(data.getGameDataPtr()
-                                      ->getOptions()
-                                      .getParam("control.interact")
-                                      .getValue());
         rectSurb.setPosition(curPosCtrl[curPosCtrlI.getValue()]);
         rectSurb.setScale(curSizeCtrl[curPosCtrlI.getValue()]);
         return GameStatus::CONTINUE;
@@ -420,10 +397,8 @@ namespace OpMon {
         for(auto &optionsMenuItem : optionsMenuItems) {
             switch(i) {
                 case 0:
-                    if(data.getGameDataPtr()
-                           ->getOptions()
-                           .getParam("fullscreen")
-                           .getValue() == "true") {
+                    if(data.getGameDataPtr()->getOptions().getBool(
+                           "fullscreen")) {
                         optionsMenuItem.setRightContent("On");
                     } else {
                         optionsMenuItem.setRightContent("Off");
@@ -440,6 +415,16 @@ namespace OpMon {
         }
     }
 
+    void OptionsMenu::initControlsValue() {
+        Utils::OptionsSave &options = data.getGameDataPtr()->getOptions();
+        txtCtrlUp.setString(options.getString("control.up"));
+        txtCtrlDown.setString(options.getString("control.down"));
+        txtCtrlLeft.setString(options.getString("control.left"));
+        txtCtrlRight.setString(options.getString("control.right"));
+        txtCtrlTalk.setString(options.getString("control.talk"));
+        txtCtrlInteract.setString(options.getString("control.interact"));
+    }
+
     void OptionsMenu::initLanguagesMenuItemsName() {
         int i = 0;
         for(auto &languagesMenuItem : languagesMenuItems) {
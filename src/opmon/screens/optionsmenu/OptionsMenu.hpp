@@ -95,6 +95,10 @@ namespace OpMon {
 
         void initOptionsMenuItemsName();
         void initOptionsMenuItemsValue();
+        /*!
+         * \brief Updates the names of the keys in the controls menu.
+         */
+        void initControlsValue();
         void initLanguagesMenuItemsName();
 
       private:
@@ -19,7 +19,6 @@
 #include "src/utils/KeyData.hpp"
 #include "src/utils/OptionsSave.hpp"
 #include "src/utils/defines.hpp"
-#include "src/utils/i18n/Translator.hpp"
 
 enum MenuOption {
     FULLSCREEN = 0,
@@ -32,7 +31,32 @@ enum MenuOption {
 namespace OpMon {
 
     OptionsMenuCtrl::OptionsMenuCtrl(GameData *data)
-        : data(data), view(this->data) {}
+        : data(data), view(this->data) {
+        // The menu is updated when the options change, which also makes it
+        // follow the changes made elsewhere.
+        Utils::OptionsSave &options = data->getOptions();
+        auto updateValues = [this](std::string const &) {
+            view.initOptionsMenuItemsValue();
+        };
+        listeners.push_back(options.addListener("fullscreen", updateValues));
+        listeners.push_back(options.addListener("volume", updateValues));
+        listeners.push_back(
+            options.addListener("lang", [this](std::string const &) {
+                view.initLanguagesMenuItemsName();
+                view.initOptionsMenuItemsName();
+            }));
+        for(std::string const &control : controlsName) {
+            listeners.push_back(options.addListener(
+                "control." + control,
+                [this](std::string const &) { view.initControlsValue(); }));
+        }
+    }
+
+    OptionsMenuCtrl::~OptionsMenuCtrl() {
+        for(unsigned int listener : listeners) {
+            data.getGameDataPtr()->getOptions().removeListener(listener);
+        }
+    }
 
     GameStatus OptionsMenuCtrl::checkEvent(sf::Event const &event) {
         auto &menu = view;
@@ -44,10 +68,9 @@ namespace OpMon {
                         const std::string &keyCode =
                             Utils::KeyData::findNameKeyCode(event.key.code);
                         if(!keyCode.empty()) {
-                            data.getGameDataPtr()->getOptions().addParam(
-                                std::string("control.") +
-                                    controlsName[currentKeyChange],
-                                keyCode.c_str());
+                            data.getGameDataPtr()->getOptions().set(
+                                "control." + controlsName[currentKeyChange],
+                                keyCode);
                         }
                         ++currentKeyChange;
                         view.setCurrentKeyChange(currentKeyChange + 1);
@@ -57,38 +80,6 @@ namespace OpMon {
                         currentKeyChange = 0;
                         keyChangeActive = false;
                         view.setCurrentKeyChange(currentKeyChange);
-                        data.getGameDataPtr()->getOptions().saveParams();
-
-                        data.getGameDataPtr()->setKeyUp(
-                            data.getGameDataPtr()
-                                ->getOptions()
-                                .getParam("control.up")
-                                .getValue());
-                        data.getGameDataPtr()->setKeyDown(
-                            data.getGameDataPtr()
-                                ->getOptions()
-                                .getParam("control.down")
-                                .getValue());
-                        data.getGameDataPtr()->setKeyLeft(
-                            data.getGameDataPtr()
-                                ->getOptions()
-                                .getParam("control.left")
-                                .getValue());
-                        data.getGameDataPtr()->setKeyRight(
-                            data.getGameDataPtr()
-                                ->getOptions()
-                                .getParam("control.right")
-                                .getValue());
-                        data.getGameDataPtr()->setKeyTalk(
-                            data.getGameDataPtr()
-                                ->getOptions()
-                                .getParam("control.talk")
-                                .getValue());
-                        data.getGameDataPtr()->setKeyInteract(
-                            data.getGameDataPtr()
-                                ->getOptions()
-                                .getParam("control.interact")
-                                .getValue());
                     }
 
                     return GameStatus::CONTINUE;
@@ -100,19 +91,10 @@ namespace OpMon {
                             case FULLSCREEN:
                                 data.getGameDataPtr()->getJukebox().playSound(
                                     "push");
-                                if(data.getGameDataPtr()
-                                       ->getOptions()
-                                       .getParam("fullscreen")
-                                       .getValue() == "true") {
-                                    data.getGameDataPtr()
-                                        ->getOptions()
-                                        .addOrModifParam("fullscreen", "false");
-                                } else {
-                                    data.getGameDataPtr()
-                                        ->getOptions()
-                                        .addOrModifParam("fullscreen", "true");
-                                }
-                                view.initOptionsMenuItemsValue();
+                                data.getGameDataPtr()->getOptions().set(
+                                    "fullscreen", !data.getGameDataPtr()
+                                                       ->getOptions()
+                                                       .getBool("fullscreen"));
                                 return GameStatus::WIN_REBOOT;
                             case LANGUAGE:
                                 data.getGameDataPtr()->getJukebox().playSound(
@@ -141,42 +123,32 @@ namespace OpMon {
                     } else if(menu.getCurrentOption() ==
                               OptionType::LANG) { // Chooses language to print
 
-                        auto &tr = Utils::I18n::Translator::getInstance();
                         data.getGameDataPtr()->getJukebox().playSound("push");
                         switch(menu.cursorPosition()) {
                             case 0:
                                 menu.setCurrentOption(OptionType::ALL);
                                 return GameStatus::CONTINUE;
                             case 1:
-                                data.getGameDataPtr()->getOptions().editParam(
+                                data.getGameDataPtr()->getOptions().set(
                                     "lang", "en");
-                                tr.setLang("en");
                                 break;
                             case 2:
-                                data.getGameDataPtr()->getOptions().editParam(
+                                data.getGameDataPtr()->getOptions().set(
                                     "lang", "es");
-                                tr.setLang("es");
                                 break;
                             case 3:
-                                data.getGameDataPtr()->getOptions().editParam(
+                                data.getGameDataPtr()->getOptions().set(
                                     "lang", "fr");
-                                tr.setLang("fr");
                                 break;
                             case 4:
-                                data.getGameDataPtr()->getOptions().editParam(
+                                data.getGameDataPtr()->getOptions().set(
                                     "lang", "de");
-                                tr.setLang("de");
                                 break;
                             case 5:
-                                data.getGameDataPtr()->getOptions().editParam(
+                                data.getGameDataPtr()->getOptions().set(
                                     "lang", "it");
-                                tr.setLang("it");
                                 break;
                         }
-                        // Refresh the content of the menu items to change the
-                        // language
-                        view.initLanguagesMenuItemsName();
-                        view.initOptionsMenuItemsName();
                     } else if(menu.getCurrentOption() == OptionType::CREDITS) {
                         // Only one choice is avilable on the credits : back.
                         data.getGameDataPtr()->getJukebox().playSound("push");
@@ -238,37 +210,23 @@ namespace OpMon {
 
     GameStatus OptionsMenuCtrl::update(sf::RenderTexture &frame) {
         GameStatus status = view.update();
-        frame.draw(view);
+        drawView(frame, view);
         return status;
     }
 
     void OptionsMenuCtrl::toggleVolume() {
-        if(data.getGameDataPtr()->getJukebox().getGlobalVolume() > 0) {
-            data.getGameDataPtr()->getJukebox().setGlobalVolume(0);
-            data.getGameDataPtr()->getOptions().editParam("volume", "0");
-        } else {
-            data.getGameDataPtr()->getJukebox().setGlobalVolume(100);
-            data.getGameDataPtr()->getOptions().editParam("volume", "100");
-        }
-        view.initOptionsMenuItemsValue();
+        Utils::OptionsSave &options = data.getGameDataPtr()->getOptions();
+        options.set("volume", options.getInt("volume") > 0 ? 0 : 100);
     }
 
     void OptionsMenuCtrl::raiseVolume() {
-        const int newVolume = std::min(
-            100, data.getGameDataPtr()->getJukebox().getGlobalVolume() + 10);
-        data.getGameDataPtr()->getJukebox().setGlobalVolume(newVolume);
-        data.getGameDataPtr()->getOptions().editParam(
-            "volume", std::to_string(newVolume));
-        view.initOptionsMenuItemsValue();
+        Utils::OptionsSave &options = data.getGameDataPtr()->getOptions();
+        options.set("volume", std::min(100, options.getInt("volume") + 10));
     }
 
     void OptionsMenuCtrl::lowerVolume() {
-        const int newVolume = std::max(
-            0, data.getGameDataPtr()->getJukebox().getGlobalVolume() - 10);
-        data.getGameDataPtr()->getJukebox().setGlobalVolume(newVolume);
-        data.getGameDataPtr()->getOptions().editParam(
-            "volume", std::to_string(newVolume));
-        view.initOptionsMenuItemsValue();
+        Utils::OptionsSave &options = data.getGameDataPtr()->getOptions();
+        options.set("volume", std::max(0, options.getInt("volume") - 10));
     }
 
 } // namespace OpMon
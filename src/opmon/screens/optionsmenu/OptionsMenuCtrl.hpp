@@ -41,10 +41,20 @@ namespace OpMon {
          */
         bool keyChangeActive {false};
 
+        /*!
+         * \brief The listeners registered in the options, removed when the menu is closed.
+         */
+        std::vector<unsigned int> listeners;
+
       public:
         OptionsMenuCtrl(GameData *data);
+        ~OptionsMenuCtrl();
         GameStatus checkEvent(sf::Event const &event) override;
         GameStatus update(sf::RenderTexture &frame) override;
+        /*!
+         * \brief The menu only changes when a key is pressed.
+         */
+        bool isDirty() const override { return false; }
 
         /*!
          * \brief The different names of the controls for the controls menu.
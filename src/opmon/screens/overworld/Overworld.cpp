@@ -13,7 +13,6 @@
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <algorithm>
-#include <iostream>
 #include <map>
 #include <sstream>
 #include <vector>
@@ -28,6 +27,8 @@
 #include "src/opmon/view/ui/Dialog.hpp"
 #include "src/opmon/view/ui/Elements.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
+#include "src/utils/FrameMetrics.hpp"
+#include "src/utils/Profiler.hpp"
 #include "src/utils/defines.hpp"
 #include "src/utils/i18n/Translator.hpp"
 #include "src/utils/log.hpp"
@@ -35,8 +36,8 @@
 
 namespace OpMon {
 
-    void Overworld::setMusic(std::string const &mus) {
-        data.getGameDataPtr()->getJukebox().play(mus);
+    void Overworld::setMusic(MusicId music) {
+        data.getGameDataPtr()->getJukebox().play(music);
     }
 
     bool Overworld::isCameraLocked() { return cameraLock; }
@@ -118,26 +119,13 @@ namespace OpMon {
 
     void Overworld::resetCamera() { camera.setCenter(character.getPosition()); }
 
-    void Overworld::updateElements() {
-        //"i" is the element's id
-        for(std::string const &i : current->getAnimatedElements()) {
-            data.incrementElementCounter(i);
-            if(data.getElementCounter(i) >= data.getElementTextures(i).size()) {
-                data.resetElementCounter(i);
-            }
-            elementsSprites[i].setTexture(data.getCurrentElementTexture(i));
-            elementsSprites[i].setPosition(data.getElementPos(i));
-        }
-    }
+    void Overworld::updateElements() { animatedElements.update(); }
 
     void Overworld::printElements(sf::RenderTarget &frame) const {
-        //"i" is the element's id
-        for(const std::pair<std::string, sf::Sprite> &spr : elementsSprites) {
-            frame.draw(spr.second);
-        }
+        frame.draw(animatedElements);
     }
 
-    void Overworld::tp(std::string toTp, sf::Vector2i pos, Side tpDir) {
+    void Overworld::tp(MapId toTp, sf::Vector2i pos, Side tpDir) {
         this->toTp = toTp;
         tpPos = pos;
         this->tpDir = tpDir;
@@ -146,9 +134,10 @@ namespace OpMon {
         character.getPositionMapRef().lockMove();
     }
 
-    void Overworld::tpNoAnim(std::string toTp, sf::Vector2i pos, Side tpDir) {
+    void Overworld::tpNoAnim(MapId toTp, sf::Vector2i pos, Side tpDir) {
         data.setCurrentMap(toTp);
         current = data.getCurrentMap();
+        animatedElements.build(current->getAnimatedElements(), data);
         character.setPosition(pos.x, pos.y);
         resetCamera();
         setMusic(current->getBg());
@@ -175,11 +164,12 @@ namespace OpMon {
         data.getGameDataPtr()->getJukebox().play(current->getBg());
     }
 
-    Overworld::Overworld(const std::string &mapId, OverworldData &data)
+    Overworld::Overworld(MapId mapId, sf::Vector2i const &position,
+                         OverworldData &data)
         : data(data), character(data.getPlayerEvent()) {
         current = data.getMap(mapId);
         data.setCurrentMap(mapId);
-        character.setPosition(2, 4);
+        character.setPosition(position.x, position.y);
         camera.setSize(sf::Vector2f(30 SQUARES, 16.875 SQUARES));
         resetCamera();
 
@@ -193,6 +183,7 @@ namespace OpMon {
         layer3 = std::make_unique<Ui::MapLayer>(
             current->getDimensions(), current->getLayer3(),
             data.getTileset(current->getTileset()));
+        animatedElements.build(current->getAnimatedElements(), data);
 
         data.getGameDataPtr()->getJukebox().play(current->getBg());
 
@@ -203,38 +194,63 @@ namespace OpMon {
             sf::RectangleShape(data.getGameDataPtr()->getWindowSize<float>());
         screenCache.setSfmlColor(sf::Color(0, 0, 0, 0));
         screenCache.setOrigin(0, 0);
+
+        // The debug texts only change when their string does
+        sf::Font const &font = data.getGameDataPtr()->getFont();
+        debugText.setString("Debug mode");
+        debugText.setPosition(0, 0);
+        debugText.setFont(font);
+        debugText.setSfmlColor(sf::Color(127, 127, 127));
+        debugText.setCharacterSize(40);
+        fpsPrint.setPosition(0, 50);
+        fpsPrint.setFont(font);
+        fpsPrint.setCharacterSize(48);
+        coordPrint.setFont(font);
+        coordPrint.setPosition(0, 100);
+        coordPrint.setSfmlColor(sf::Color(127, 127, 127));
+        coordPrint.setCharacterSize(30);
     }
 
     void Overworld::draw(sf::RenderTarget &frame,
                          sf::RenderStates states) const {
+        OPMON_PROFILE_ZONE("Overworld::draw");
         bool is_in_dialog = this->dialog && !this->dialog->isDialogOver();
         frame.setView(camera);
         frame.clear(sf::Color::Black);
+        // Draw calls issued directly by the overworld, for the frame metrics
+        unsigned int drawCalls = 0;
 
         // Drawing the two first layers
         if((debugMode ? printlayer[0] : true)) {
             frame.draw(*layer1);
+            drawCalls++;
         }
         if((debugMode ? printlayer[1] : true)) {
             frame.draw(*layer2);
+            drawCalls++;
         }
         // Drawing events under the player
         for(const Elements::AbstractEvent *event : current->getEvents()) {
             const sf::Sprite *sprite = event->getSprite();
             if(sprite->getPosition().y <= character.getPosition().y) {
                 frame.draw(*sprite);
+                drawCalls++;
             }
         }
+        drawCalls += current->getCharacters().draw(frame, false);
 
         frame.draw(*character.getSprite());
+        drawCalls++;
 
         // Drawing the events above the player
         for(const Elements::AbstractEvent *event : current->getEvents()) {
             const sf::Sprite *sprite = event->getSprite();
             if(sprite->getPosition().y > character.getPosition().y) {
                 frame.draw(*sprite);
+                drawCalls++;
             }
         }
+        drawCalls += current->getCharacters().draw(frame, true);
 
         if(debugMode && printCollisions) {
             printCollisionLayer(frame);
@@ -243,31 +259,39 @@ namespace OpMon {
         // Drawing the third layer
         if((debugMode ? printlayer[2] : true)) {
             frame.draw(*layer3);
+            drawCalls++;
         }
 
         printElements(frame);
+        drawCalls += animatedElements.getDrawCalls();
 
         /***** draw GUI *****/
         frame.setView(frame.getDefaultView());
 
         if(is_in_dialog) {
             frame.draw(*this->dialog);
+            drawCalls++;
         }
 
         frame.draw(screenCache);
+        drawCalls++;
 
         if(debugMode) {
             frame.draw(debugText);
             frame.draw(fpsPrint);
             frame.draw(coordPrint);
+            drawCalls += 3;
         }
+        Utils::FrameMetrics::getInstance().addCount(
+            Utils::FrameMetrics::OVERWORLD_DRAW_CALLS, drawCalls);
     }
 
     GameStatus Overworld::update() {
+        OPMON_PROFILE_ZONE("Overworld::update");
         bool is_in_dialog = this->dialog && !this->dialog->isDialogOver();
 
         if(initPlayerAnimation) {
-            startPlayerAnimationTime = Utils::Time::getElapsedMilliseconds();
+            startPlayerAnimationTime = Utils::Time::getGameMilliseconds();
             initPlayerAnimation = false;
         }
 
@@ -276,40 +300,28 @@ namespace OpMon {
             fpsPrint.setString(std::to_string(fpsCounter));
             fpsCounter = 0;
             oldTicksFps = Utils::Time::getElapsedMilliseconds();
+
+            if(debugMode &&
+               Utils::Log::isEnabled(Utils::Log::Level::VERBOSE)) {
+                auto positionMap = character.getPositionMap();
+                std::ostringstream state;
+                state << "Loop: " << (is_in_dialog ? "Dialog" : "Normal")
+                      << " - Position: " << positionMap.getPosition().x
+                      << ", " << positionMap.getPosition().y
+                      << " - PxPosition: " << character.getPosition().x
+                      << ", " << character.getPosition().y
+                      << " - Moving: " << positionMap.isMoving()
+                      << " - Anim: " << positionMap.isAnim()
+                      << " - Direction: " << (int)positionMap.getDir()
+                      << " - Start player animation time: "
+                      << (double)startPlayerAnimationTime / 1000;
+                Utils::Log::log(Utils::Log::Level::VERBOSE, "overworld",
+                                state.str());
+            }
         }
 
-        if(debugMode) {
-            std::cout << "Elapsed Time: " << Utils::Time::getElapsedSeconds()
-                      << "s" << std::endl;
-            std::cout << "Loop : " << (is_in_dialog ? "Dialog" : "Normal")
-                      << std::endl;
-            std::cout << "PlayerPosition: "
-                      << character.getPositionMap().getPosition().x << " - "
-                      << character.getPositionMap().getPosition().y
-                      << std::endl;
-            std::cout << "PlayerPositionPx: " << character.getPosition().x
-                      << " - " << character.getPosition().y << std::endl;
-            std::cout << "Moving: "
-                      << (character.getPositionMap().isMoving() ? "true" :
-                                                                  "false")
-                      << std::endl;
-            std::cout << "Anim: "
-                      << (character.getPositionMap().isAnim() ? "true" :
-                                                                "false")
-                      << std::endl;
-            std::cout << "PlayerDirection: "
-                      << (int)character.getPositionMap().getDir() << std::endl;
-            std::cout << "Start player Animation Time: "
-                      << (double)startPlayerAnimationTime / 1000 << std::endl;
-
-            debugText.setString("Debug mode");
-            debugText.setPosition(0, 0);
-            debugText.setFont(data.getGameDataPtr()->getFont());
-            debugText.setSfmlColor(sf::Color(127, 127, 127));
-            debugText.setCharacterSize(40);
-            fpsPrint.setPosition(0, 50);
-            fpsPrint.setFont(data.getGameDataPtr()->getFont());
-            fpsPrint.setCharacterSize(48);
+        if(debugMode && character.getPosition() != printedPosition) {
+            printedPosition = character.getPosition();
             std::ostringstream oss;
             oss << "Position : " << character.getPositionMap().getPosition().x
                 << " - " << character.getPositionMap().getPosition().y
@@ -317,10 +329,6 @@ namespace OpMon {
                 << "PxPosition : " << character.getPosition().x << " - "
                 << character.getPosition().y << std::endl;
             coordPrint.setString(oss.str());
-            coordPrint.setFont(data.getGameDataPtr()->getFont());
-            coordPrint.setPosition(0, 100);
-            coordPrint.setSfmlColor(sf::Color(127, 127, 127));
-            coordPrint.setCharacterSize(30);
         }
 
         if(is_in_dialog) {
@@ -336,6 +344,7 @@ namespace OpMon {
 
         character.update(*this);
         character.updateFrame();
+        current->getCharacters().updateQuads(character.getPosition().y);
 
         // Updates the events above the player
         for(Elements::AbstractEvent *event : current->getEvents()) {
@@ -399,7 +408,7 @@ namespace OpMon {
     /**
      * Events can call this method to start a new dialog with the player.
      */
-    void Overworld::startDialog(sf::String const &dialog) {
+    void Overworld::startDialog(Utils::OpString const &dialog) {
         if(this->dialog) {
             if(!this->dialog->isDialogOver()) {
                 Utils::Log::oplog("WARNING: We create a new dialog ... but the "
@@ -11,6 +11,7 @@
 
 #include "OverworldData.hpp"
 #include "src/opmon/core/GameStatus.hpp"
+#include "src/opmon/view/elements/AnimatedElements.hpp"
 #include "src/opmon/view/elements/events/BattleEvent.hpp"
 #include "src/opmon/view/ui/Dialog.hpp"
 #include "src/opmon/view/ui/Elements.hpp"
@@ -35,7 +36,12 @@ namespace OpMon {
      */
     class Overworld : public sf::Drawable {
       public:
-        Overworld(const std::string &mapId, OverworldData &data);
+        /*!
+         * \param mapId The map where the player starts.
+         * \param position The position of the player on this map, in squares.
+         */
+        Overworld(MapId mapId, sf::Vector2i const &position,
+                  OverworldData &data);
 
         Elements::PlayerEvent &getCharacter() { return character; }
 
@@ -59,7 +65,7 @@ namespace OpMon {
          * \param tpDir The direction the player will face after the teleportation.
          * Side::NO_MOVE will keep the direction the player was facing before.
          */
-        void tp(std::string toTp, sf::Vector2i pos, Side tpDir = Side::NO_MOVE);
+        void tp(MapId toTp, sf::Vector2i pos, Side tpDir = Side::NO_MOVE);
 
         /*!
          * \brief Directly teleports the player without any animation.
@@ -68,8 +74,7 @@ namespace OpMon {
          * \param tpDir The direction the player will face after the teleportation.
          * Side::NO_MOVE will keep the direction the player was facing before.
          */
-        void tpNoAnim(std::string toTp, sf::Vector2i pos,
-                      Side tpDir = Side::NO_MOVE);
+        void tpNoAnim(MapId toTp, sf::Vector2i pos, Side tpDir = Side::NO_MOVE);
 
         /*!
          * \brief Returns a layer of the map the player is currently in.
@@ -115,7 +120,7 @@ namespace OpMon {
          * \brief Plays the music given in parameter.
          * \deprectated Directly use Jukebox::play.
          */
-        void setMusic(std::string const &path);
+        void setMusic(MusicId music);
 
         Elements::BattleEvent *getBattleDeclared() { return trainerToBattle; }
 
@@ -157,7 +162,7 @@ namespace OpMon {
         /*!
          * \brief Events can call this method to start a new dialog with the player.
          */
-        void startDialog(sf::String const &dialog);
+        void startDialog(Utils::OpString const &dialog);
 
         /*!
          * \brief Animates the player.
@@ -252,7 +257,7 @@ namespace OpMon {
         /*!
          * \brief The map where the player has to TP during the fade animation.
          */
-        std::string toTp;
+        MapId toTp;
 
         /*!
          * \brief The position where the player has to TP during the fade animation.
@@ -267,6 +272,10 @@ namespace OpMon {
         int fpsCounter = 0;
         sf::Text fpsPrint;
         sf::Text coordPrint;
+        /*!
+         * \brief The pixel position shown by Overworld::coordPrint, so that the text is only rebuilt when the player moves.
+         */
+        sf::Vector2f printedPosition = sf::Vector2f(-1, -1);
         int oldTicksFps = 0;
 
         int animsCounter = 0;
@@ -275,7 +284,10 @@ namespace OpMon {
 
         bool cameraLock = false;
 
-        std::map<std::string, sf::Sprite> elementsSprites;
+        /*!
+         * \brief The animated elements of the current map.
+         */
+        Elements::AnimatedElements animatedElements;
 
         OverworldData &data;
     };
@@ -11,11 +11,14 @@
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <memory>
+#include <utility>
 
 #include "Overworld.hpp"
 #include "src/opmon/core/GameData.hpp"
 #include "src/opmon/core/GameStatus.hpp"
 #include "src/opmon/core/Player.hpp"
+#include "src/opmon/core/SaveGame.hpp"
+#include "src/opmon/core/system/path.hpp"
 #include "src/opmon/screens/animation/AnimationCtrl.hpp"
 #include "src/opmon/screens/animation/Animations.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
@@ -23,9 +26,12 @@
 #include "src/opmon/screens/gamemenu/GameMenuCtrl.hpp"
 #include "src/opmon/screens/gamemenu/GameMenuData.hpp"
 #include "src/opmon/view/elements/Map.hpp"
+#include "src/opmon/view/elements/Pathfinder.hpp"
 #include "src/opmon/view/elements/Position.hpp"
 #include "src/opmon/view/ui/Dialog.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
+#include "src/utils/Profiler.hpp"
+#include "src/utils/log.hpp"
 
 // Defines created to make the code easier to read
 #define LOAD_BATTLE 1
@@ -35,9 +41,37 @@
 
 namespace OpMon {
 
-    OverworldCtrl::OverworldCtrl(Player &player, GameData *gamedata)
-        : data(gamedata, &player),
-          view("player_room", this->data),
+    namespace {
+        /*!
+         * \brief Loads the textures of the data, before the view uses them.
+         */
+        OverworldData &loadTextures(OverworldData &data) {
+            data.loadTextures();
+            return data;
+        }
+    } // namespace
+
+    std::unique_ptr<OverworldData>
+        OverworldCtrl::prepareData(Player &player, GameData *gamedata,
+                                   SaveGame::State const *save,
+                                   Utils::LoadingProgress &progress) {
+        auto data = std::make_unique<OverworldData>(gamedata, &player, progress);
+        if(save) {
+            SaveGame::apply(*save, *gamedata, player, *data);
+            data->setCurrentMap(MapId::find(save->map));
+        }
+        return data;
+    }
+
+    OverworldCtrl::OverworldCtrl(Player &player,
+                                 std::unique_ptr<OverworldData> data,
+                                 SaveGame::State const *save)
+        : ownedData(std::move(data)),
+          data(loadTextures(*ownedData)),
+          view(this->data.getCurrentMapId(),
+               save ? sf::Vector2i(save->positionX, save->positionY) :
+                      sf::Vector2i(2, 4),
+               this->data),
           player(player) {}
 
     GameStatus OverworldCtrl::checkEvent(sf::Event const &events) {
@@ -58,6 +92,9 @@ namespace OpMon {
                 // The key equals starts the debug mode
                 if(events.key.code == sf::Keyboard::Equal) {
                     view.debugMode = !view.debugMode;
+                    Utils::Log::setLevel(view.debugMode ?
+                                             Utils::Log::Level::VERBOSE :
+                                             Utils::Log::Level::INFO);
                     if(!view.debugMode) {
                         debugCol = false;
                         overworld.setCameraLock(false);
@@ -99,11 +136,15 @@ namespace OpMon {
                                      sf::Vector2i(5, 5));
                     }
                     if(events.key.code == sf::Keyboard::B) {
-                        overworld.tp("road_14", sf::Vector2i(10, 32));
+                        overworld.tp(MapId::find("road_14"),
+                                     sf::Vector2i(10, 32));
                     }
                 }
                 if(events.key.code == sf::Keyboard::M) {
+                    autosave();
                     loadNext = LOAD_MENU_OPEN;
+                    // The frame still contains the last overworld frame
+                    screenSnapshot = data.getGameDataPtr()->window.snapshot();
                     return GameStatus::NEXT_NLS;
                 }
             default:
@@ -151,6 +192,7 @@ namespace OpMon {
                 view.endBattle();
             } else {
                 loadNext = LOAD_BATTLE;
+                screenSnapshot = data.getGameDataPtr()->window.snapshot();
                 return GameStatus::NEXT;
             }
         }
@@ -159,41 +201,54 @@ namespace OpMon {
     }
 
     GameStatus OverworldCtrl::update(sf::RenderTexture &frame) {
+        OPMON_PROFILE_ZONE("OverworldCtrl::update");
         bool is_dialog_open =
             view.getDialog() && !view.getDialog()->isDialogOver();
         if(!is_dialog_open) {
+            data.getCurrentMap()->getPathfinder().newTick();
             updateEvents(data.getCurrentMap()->getEvents(), view);
+            data.getCurrentMap()->getCharacters().update(view);
         }
 
         GameStatus toReturn = view.update();
-        frame.draw(view);
-        screenTexture = frame.getTexture();
+        drawView(frame, view);
         return toReturn;
     }
 
+    void OverworldCtrl::prepareNextScreen(Utils::LoadingProgress &progress) {
+        if(loadNext == LOAD_BATTLE) {
+            progress.addSteps(1);
+            data.getBattleData().preload();
+            progress.advance();
+        }
+    }
+
     void OverworldCtrl::loadNextScreen() {
-        data.getGameMenuData().setBackground(screenTexture);
+        data.getGameMenuData().setBackground(screenSnapshot->getTexture());
         switch(loadNext) {
             case LOAD_BATTLE:
+                data.getBattleData().load();
                 _next_gs = std::make_unique<BattleCtrl>(
                     data.getPlayer().getOpTeam(), view.getBattleDeclared(),
-                    data.getGameDataPtr(), data.getPlayerPtr());
+                    data.getBattleData());
                 break;
             case LOAD_MENU_OPEN:
                 _next_gs = std::make_unique<AnimationCtrl>(
                     std::make_unique<Animations::WooshAnim>(
-                        screenTexture, data.getGameMenuData().getMenuTexture(),
-                        Animations::WooshDir::UP, 15, true));
+                        screenSnapshot->getTexture(),
+                        data.getGameMenuData().getMenuTexture(),
+                        Animations::WooshDir::UP, 500, true));
                 break;
             case LOAD_MENU:
                 _next_gs = std::make_unique<GameMenuCtrl>(
-                    data.getGameMenuData(), player);
+                    data.getGameMenuData(), player, lastSave);
                 break;
             case LOAD_MENU_CLOSE:
                 _next_gs = std::make_unique<AnimationCtrl>(
                     std::make_unique<Animations::WooshAnim>(
-                        screenTexture, data.getGameMenuData().getMenuTexture(),
-                        Animations::WooshDir::DOWN, 15, false));
+                        screenSnapshot->getTexture(),
+                        data.getGameMenuData().getMenuTexture(),
+                        Animations::WooshDir::DOWN, 500, false));
                 break;
             default:
                 throw Utils::UnexpectedValueException(
@@ -212,6 +267,13 @@ namespace OpMon {
         data.getGameDataPtr()->getJukebox().play(data.getCurrentMap()->getBg());
     }
 
+    void OverworldCtrl::autosave() {
+        lastSave = SaveGame::capture(
+            player, data, view.getCharacter().getPositionMap().getPosition());
+        SaveGame::getInstance().write(lastSave,
+                                      Path::getSavePath() + "autosave.opsave");
+    }
+
     void OverworldCtrl::checkMove(Overworld &overworld) {
         if(!overworld.justTp &&
            !overworld.getCharacter().getPositionMap().isAnim() &&
@@ -246,6 +308,10 @@ namespace OpMon {
         std::list<Elements::AbstractEvent *> eventList = map->getEvent(
             overworld.getCharacter().getPositionMap().getPosition());
         actionEvents(eventList, Elements::EventTrigger::GO_IN, overworld);
+        map->getCharacters().trigger(
+            overworld.getCharacter().getPositionMap().getPosition(),
+            Elements::EventTrigger::GO_IN,
+            overworld.getCharacter().getPositionMap().getDir());
     }
 
     void OverworldCtrl::checkAction(sf::Event const &event,
@@ -310,6 +376,9 @@ namespace OpMon {
 
                 actionEvents(eventList, Elements::EventTrigger::PRESS,
                              overworld);
+                overworld.getData().getCurrentMap()->getCharacters().trigger(
+                    sf::Vector2i(lx, ly), Elements::EventTrigger::PRESS,
+                    overworld.getCharacter().getPositionMap().getDir());
             }
         }
 
@@ -322,6 +391,10 @@ namespace OpMon {
                 overworld.getData().getCurrentMap()->getEvent(
                     overworld.getCharacter().getPositionMap().getPosition());
             actionEvents(eventList, Elements::EventTrigger::BE_IN, overworld);
+            overworld.getData().getCurrentMap()->getCharacters().trigger(
+                overworld.getCharacter().getPositionMap().getPosition(),
+                Elements::EventTrigger::BE_IN,
+                overworld.getCharacter().getPositionMap().getDir());
         }
     }
 
@@ -358,6 +431,7 @@ namespace OpMon {
 
     void OverworldCtrl::updateEvents(
         std::vector<Elements::AbstractEvent *> &events, Overworld &overworld) {
+        OPMON_PROFILE_ZONE("OverworldCtrl::updateEvents");
         for(Elements::AbstractEvent *event : events) {
             event->update(overworld);
         }
@@ -8,8 +8,10 @@
 #define OVERWORLDCTRL_HPP
 
 #include <list>
+#include <memory>
 
 #include "Overworld.hpp"
+#include "src/opmon/core/SaveGame.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
 
 namespace sf {
@@ -33,7 +35,11 @@ namespace OpMon {
      */
     class OverworldCtrl : public AGameScreen {
       private:
-        OverworldData data;
+        /*!
+         * \brief The data given to the constructor, used through OverworldCtrl::data.
+         */
+        std::unique_ptr<OverworldData> ownedData;
+        OverworldData &data;
 
         Overworld view;
         Player &player;
@@ -58,9 +64,9 @@ namespace OpMon {
 
         /*!
          * \brief Contains a screenshot.
-         * \details A screenshot of the frame is taken in update(sf::RenderTexture&). It used as a background in GameMenu and its opening/closing animations.
+         * \details A screenshot of the frame is taken when the menu opens or when a battle starts (see Ui::Window::snapshot). It is used as a background in GameMenu and its opening/closing animations.
          */
-        sf::Texture screenTexture;
+        std::shared_ptr<const sf::RenderTexture> screenSnapshot;
 
         /*!
          * \brief If `true`, the collision debug mode is activated (noclip).
@@ -75,8 +81,35 @@ namespace OpMon {
          */
         std::list<Elements::AbstractEvent *> usedList;
 
+        /*!
+         * \brief The state of the game captured by the last call to autosave(), given to the menu to save it in a file.
+         */
+        std::shared_ptr<const SaveGame::State> lastSave;
+
+        /*!
+         * \brief Saves the game in the autosave file, in the background (see SaveGame).
+         */
+        void autosave();
+
       public:
-        OverworldCtrl(Player &player, GameData *gamedata);
+        /*!
+         * \brief Prepares the data of the overworld.
+         * \details Called in AGameScreen::prepareNextScreen() by the screens starting the overworld, as it doesn't use the graphics context. The textures are then loaded by the constructor, in the main thread.
+         * \param save The save to resume, read by SaveGame::read(), or `nullptr` for a new game. It is applied to the player and to the data, and its map becomes the current map.
+         * \throws Utils::LoadingException If the save can't be applied (see SaveGame::apply()).
+         */
+        static std::unique_ptr<OverworldData>
+            prepareData(Player &player, GameData *gamedata,
+                        SaveGame::State const *save,
+                        Utils::LoadingProgress &progress);
+
+        /*!
+         * \brief Starts the overworld on the current map of the data.
+         * \param data The data returned by prepareData().
+         * \param save The save given to prepareData(), whose position is used. If `nullptr`, the player starts at the position of a new game.
+         */
+        OverworldCtrl(Player &player, std::unique_ptr<OverworldData> data,
+                      SaveGame::State const *save = nullptr);
 
         GameStatus checkEvent(sf::Event const &event) override;
         /*!
@@ -90,6 +123,7 @@ namespace OpMon {
         GameStatus checkEventsNoDialog(sf::Event const &events);
         GameStatus update(sf::RenderTexture &frame) override;
 
+        void prepareNextScreen(Utils::LoadingProgress &progress) override;
         virtual void loadNextScreen();
         virtual void suspend();
         virtual void resume();
@@ -8,13 +8,14 @@
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 
 #include "src/nlohmann/json.hpp"
 #include "src/opmon/core/GameData.hpp"
 #include "src/opmon/core/Player.hpp"
 #include "src/opmon/core/system/path.hpp"
 #include "src/opmon/model/Enums.hpp"
-#include "src/opmon/model/Move.hpp"
+#include "src/opmon/model/MoveData.hpp"
 #include "src/opmon/model/Nature.hpp"
 #include "src/opmon/model/OpMon.hpp"
 #include "src/opmon/model/OpTeam.hpp"
@@ -25,209 +26,354 @@
 
 namespace OpMon {
 
-    OverworldData::OverworldData(GameData *gamedata, Player *player)
-        : gamedata(gamedata), player(player), gameMenuData(gamedata, player) {
+    namespace {
+        /*!
+         * \brief Returns the files of a directory of the data, relative to the resource folder.
+         */
+        std::vector<std::filesystem::path>
+            listDataFiles(std::string const &directory) {
+            std::vector<std::filesystem::path> files;
+            for(std::filesystem::directory_entry const &file :
+                std::filesystem::directory_iterator(Path::getResourcePath() +
+                                                    directory)) {
+                if(file.is_regular_file()) {
+                    files.push_back(file.path());
+                }
+            }
+            return files;
+        }
+
+        std::vector<nlohmann::json> readResourceLists() {
+            std::vector<nlohmann::json> lists;
+            for(std::filesystem::path const &file :
+                listDataFiles("data/resourcelist")) {
+                std::ifstream listFile(file);
+                listFile >> lists.emplace_back();
+            }
+            return lists;
+        }
+
+        /*!
+         * \brief Lists the images used by the overworld, as one function decoding each of them.
+         * \details The images are listed first, so that the progress is known before decoding them.
+         */
+        std::vector<std::function<void()>>
+            listImages(std::vector<nlohmann::json> const &resourceLists) {
+            using Utils::ResourceLoader;
+            std::vector<std::function<void()>> images;
+            images.emplace_back([] {
+                ResourceLoader::preloadImage("sprites/chara/pp/pp_anim.png");
+            });
+            images.emplace_back(&GameMenuData::preloadImages);
+            for(nlohmann::json const &listJson : resourceLists) {
+                for(const char *type : {"events", "tilesets"}) {
+                    for(nlohmann::json const &element : listJson.value(
+                            type, nlohmann::json::array())) {
+                        std::string path = element.at("path");
+                        images.emplace_back(
+                            [path] { ResourceLoader::preloadImage(path); });
+                    }
+                }
+                for(nlohmann::json const &element :
+                    listJson.value("elements", nlohmann::json::array())) {
+                    std::string path = element.at("path");
+                    size_t frames = element.at("frames");
+                    size_t offset = element.value("offset", 1);
+                    images.emplace_back([path, frames, offset] {
+                        ResourceLoader::preloadImageArray(path, frames,
+                                                          offset);
+                    });
+                }
+            }
+            return images;
+        }
+    } // namespace
+
+    OverworldData::OverworldData(GameData *gamedata, Player *player,
+                                 Utils::LoadingProgress &progress)
+        : gamedata(gamedata),
+          player(player),
+          gameMenuData(gamedata, player),
+          battleData(gamedata, player) {
         using namespace Utils;
 
-        Move::initMoves(std::filesystem::directory_iterator(
+        std::vector<nlohmann::json> resourceLists = readResourceLists();
+        std::vector<std::function<void()>> images = listImages(resourceLists);
+        std::vector<std::filesystem::path> itemsFiles =
+            listDataFiles("data/items");
+        std::vector<std::filesystem::path> trainersFiles =
+            listDataFiles("data/trainers");
+        std::vector<std::filesystem::path> mapsFiles =
+            listDataFiles("data/maps");
+        // One step for the moves, then one per image and per data file
+        progress.addSteps(1 + images.size() + itemsFiles.size() +
+                          trainersFiles.size() + mapsFiles.size());
+
+        MoveRegistry::getInstance().load(std::filesystem::directory_iterator(
             Path::getResourcePath() + "data/moves"));
+        progress.advance();
+
+        // The textures are only created by loadTextures()
+        for(auto const &preload : images) {
+            preload();
+            progress.advance();
+        }
 
         player->addOpToOpTeam(new OpMon(
             "", gamedata->getOp(4), 5,
-            {Move::newMove("Tackle"), Move::newMove("Growl"), nullptr, nullptr},
+            {Move("Tackle"), Move("Growl"), Move(), Move()},
             Nature::QUIET));
 
-        // PP texture and rect loading
-        Utils::ResourceLoader::load(texturePP, "sprites/chara/pp/pp_anim.png");
+        // PP rect loading
         for(unsigned int i = 0; i < 12; i++) {
             texturePPRect.push_back(
                 sf::IntRect((i * 32) % 128, (i / 4) * 32, 32, 32));
         }
 
         // Initialization of the textures of the events
-        for(std::filesystem::directory_entry const &file :
-            std::filesystem::directory_iterator(Path::getResourcePath() +
-                                                "data/resourcelist")) {
-            if(file.is_regular_file()) {
-                std::ifstream listFile(file.path());
-                nlohmann::json listJson;
-                listFile >> listJson;
-                if(listJson.contains("events")) {
-                    for(nlohmann::json element : listJson.at("events")) {
-                        Utils::ResourceLoader::load(
-                            eventsTextures[element.at("id")],
-                            element.at("path"));
+        for(nlohmann::json const &listJson : resourceLists) {
+            if(listJson.contains("events")) {
+                for(nlohmann::json const &element : listJson.at("events")) {
+                    unsigned int id =
+                        EventTextureId::intern(element.at("id")).getIndex();
+                    if(id >= eventsTextures.size()) {
+                        eventsTextures.resize(id + 1);
+                        eventsTexturesPaths.resize(id + 1);
                     }
+                    eventsTexturesPaths[id] = element.at("path");
                 }
-                if(listJson.contains("elements")) {
-                    for(nlohmann::json element : listJson.at("elements")) {
-                        elementsCounter[element.at("id")] = 0;
-                        elementsPos[element.at("id")] =
-                            sf::Vector2f(element.at("position")[0],
-                                         element.at("position")[1]);
-                        Utils::ResourceLoader::loadTextureArray(
-                            elementsTextures[element.at("id")],
-                            element.at("path"), element.at("frames"),
-                            element.value("offset", 1));
+            }
+            if(listJson.contains("elements")) {
+                for(nlohmann::json const &element : listJson.at("elements")) {
+                    unsigned int id =
+                        ElementId::intern(element.at("id")).getIndex();
+                    if(id >= elements.size()) {
+                        elements.resize(id + 1);
                     }
+                    std::vector<sf::Image> frames;
+                    Utils::ResourceLoader::loadImageArray(
+                        frames, element.at("path"), element.at("frames"),
+                        element.value("offset", 1));
+                    elements[id].position = sf::Vector2f(
+                        element.at("position")[0], element.at("position")[1]);
+                    elements[id].frameCount = frames.size();
+                    elements[id].frameTicks =
+                        std::max(1u, element.value("frameTicks", 1u));
+                    elements[id].firstFrame =
+                        elementsAtlas.add(std::move(frames));
                 }
-                if(listJson.contains("tilesets")) {
-                    for(nlohmann::json element : listJson.at("tilesets")) {
-                        Utils::ResourceLoader::load(
-                            tilesets[element.at("id")].first,
-                            element.at("path"));
-                        tilesets[element.at("id")].second = (int *)malloc(
-                            sizeof(int) * element.at("collisions").size());
-                        for(size_t i = 0; i < element.at("collisions").size();
-                            i++) {
-                            tilesets[element.at("id")].second[i] =
-                                element.at("collisions")[i];
-                        }
+            }
+            if(listJson.contains("tilesets")) {
+                for(nlohmann::json const &element : listJson.at("tilesets")) {
+                    unsigned int id =
+                        TilesetId::intern(element.at("id")).getIndex();
+                    if(id >= tilesets.size()) {
+                        tilesets.resize(id + 1, std::make_pair(sf::Texture(),
+                                                               (int *)nullptr));
+                        tilesetsPaths.resize(id + 1);
+                    }
+                    tilesetsPaths[id] = element.at("path");
+                    free(tilesets[id].second);
+                    tilesets[id].second = (int *)malloc(
+                        sizeof(int) * element.at("collisions").size());
+                    for(size_t i = 0; i < element.at("collisions").size();
+                        i++) {
+                        tilesets[id].second[i] = element.at("collisions")[i];
                     }
                 }
             }
         }
+        elementsAtlas.pack();
 
         // Items initialisation
-        for(std::filesystem::directory_entry const &file :
-            std::filesystem::directory_iterator(Path::getResourcePath() +
-                                                "data/items")) {
-            if(file.is_regular_file()) {
-                Utils::Log::oplog("Found items file " +
-                                  file.path().generic_string());
-                nlohmann::json itemsJson;
-
-                std::ifstream itemsJsonFile(file.path());
-
-                if(!itemsJsonFile) {
-                    throw Utils::LoadingException("items.json", true);
-                }
+        for(std::filesystem::path const &file : itemsFiles) {
+            Utils::Log::oplog("Found items file " + file.generic_string());
+            nlohmann::json itemsJson;
+
+            std::ifstream itemsJsonFile(file);
+
+            if(!itemsJsonFile) {
+                throw Utils::LoadingException("items.json", true);
+            }
+
+            itemsJsonFile >> itemsJson;
 
-                itemsJsonFile >> itemsJson;
-
-                for(auto itor = itemsJson.begin(); itor != itemsJson.end();
-                    ++itor) {
-                    std::vector<std::unique_ptr<ItemEffect>>
-                        effects; // 0 is opmon, 1 is player, 2 is held
-                    for(auto eitor = itor->at("effects").begin();
-                        eitor != itor->at("effects").end(); ++eitor) {
-                        if(eitor->at("type") == "HpHealEffect") {
-                            effects.push_back(
-                                std::make_unique<Items::HpHealEffect>(
-                                    eitor->at("healed")));
-                        } else {
-                            effects.push_back(nullptr);
-                        }
+            for(auto itor = itemsJson.begin(); itor != itemsJson.end();
+                ++itor) {
+                std::vector<std::unique_ptr<ItemEffect>>
+                    effects; // 0 is opmon, 1 is player, 2 is held
+                for(auto eitor = itor->at("effects").begin();
+                    eitor != itor->at("effects").end(); ++eitor) {
+                    if(eitor->at("type") == "HpHealEffect") {
+                        effects.push_back(std::make_unique<Items::HpHealEffect>(
+                            eitor->at("healed")));
+                    } else {
+                        effects.push_back(nullptr);
                     }
-                    std::string itemId = itor->at("id");
-                    itemsList.emplace(
-                        itemId,
-                        std::make_unique<Item>(
-                            Utils::OpString(gamedata->getStringKeys(),
-                                            "items." + itemId + ".name"),
-                            itor->at("usable"), itor->at("onOpMon"),
-                            std::move(effects[0]), std::move(effects[1]),
-                            std::move(effects[2])));
                 }
+                std::string itemId = itor->at("id");
+                unsigned int index = ItemId::intern(itemId).getIndex();
+                if(index >= itemsList.size()) {
+                    itemsList.resize(index + 1);
+                }
+                itemsList[index] = std::make_unique<Item>(
+                    Utils::OpString(gamedata->getStringKeys(),
+                                    "items." + itemId + ".name"),
+                    itor->at("usable"), itor->at("onOpMon"),
+                    std::move(effects[0]), std::move(effects[1]),
+                    std::move(effects[2]));
             }
+            progress.advance();
         }
 
-        for(std::filesystem::directory_entry const &file :
-            std::filesystem::directory_iterator(Path::getResourcePath() +
-                                                "data/trainers")) {
-            if(file.is_regular_file()) {
-                Utils::Log::oplog("Found trainers file " +
-                                  file.path().generic_string());
-                std::ifstream trainersFile(file.path());
-                nlohmann::json trainersJson;
-                trainersFile >> trainersJson;
-
-                for(auto itor = trainersJson.begin();
-                    itor != trainersJson.end(); ++itor) {
-                    OpTeam *team = new OpTeam(itor->at("name"));
-                    for(auto opmonItor = itor->at("team").begin();
-                        opmonItor != itor->at("team").end(); ++opmonItor) {
-                        team->addOpMon(new OpMon(
-                            opmonItor->at("nickname"),
-                            gamedata->getOp(opmonItor->at("species")),
-                            opmonItor->at("level"),
-                            {Move::newMove(opmonItor->at("moves")[0]),
-                             Move::newMove(opmonItor->at("moves")[1]),
-                             Move::newMove(opmonItor->at("moves")[2]),
-                             Move::newMove(opmonItor->at("moves")[3])},
-                            opmonItor->at("nature")));
+        for(std::filesystem::path const &file : trainersFiles) {
+            Utils::Log::oplog("Found trainers file " + file.generic_string());
+            std::ifstream trainersFile(file);
+            nlohmann::json trainersJson;
+            trainersFile >> trainersJson;
+
+            for(auto itor = trainersJson.begin(); itor != trainersJson.end();
+                ++itor) {
+                OpTeam *team = new OpTeam(itor->at("name"));
+                for(auto opmonItor = itor->at("team").begin();
+                    opmonItor != itor->at("team").end(); ++opmonItor) {
+                    std::array<Move, 4> moves;
+                    for(unsigned int i = 0; i < moves.size(); i++) {
+                        moves[i] =
+                            Move(opmonItor->at("moves")[i].get<std::string>());
                     }
-                    trainers.emplace(itor->at("name"), team);
-                    std::string strName = itor->at("name");
-                    Utils::Log::oplog("Loaded trainer " + strName);
+                    team->addOpMon(new OpMon(
+                        opmonItor->at("nickname"),
+                        gamedata->getOp(opmonItor->at("species")),
+                        opmonItor->at("level"), moves,
+                        opmonItor->at("nature")));
                 }
+                trainers.emplace(itor->at("name"), team);
+                std::string strName = itor->at("name");
+                Utils::Log::oplog("Loaded trainer " + strName);
             }
+            progress.advance();
         }
 
         completions.emplace("playername", player->getNameP());
 
-        // Maps loading
-        for(std::filesystem::directory_entry const &file :
-            std::filesystem::directory_iterator(
-                Path::getResourcePath() +
-                "data/maps")) { // One map per JSON file
-            if(file.is_regular_file()) {
-                Utils::Log::oplog("Found map file " +
-                                  file.path().generic_string());
-                nlohmann::json mapJson;
-                std::ifstream mapFile(file.path());
-                mapFile >> mapJson;
-                maps.emplace(mapJson.at("id"),
-                             std::pair<nlohmann::json, Elements::Map *>(
-                                 mapJson, nullptr));
+        // Maps loading, one map per JSON file
+        for(std::filesystem::path const &file : mapsFiles) {
+            Utils::Log::oplog("Found map file " + file.generic_string());
+            nlohmann::json mapJson;
+            std::ifstream mapFile(file);
+            mapFile >> mapJson;
+            MapId id = MapId::intern(mapJson.at("id"));
+            if(id.getIndex() >= maps.size()) {
+                maps.resize(id.getIndex() + 1,
+                            std::pair<nlohmann::json, Elements::Map *>(
+                                nlohmann::json(), nullptr));
             }
+            maps[id.getIndex()].first = std::move(mapJson);
+            mapIds.push_back(id);
+            progress.advance();
         }
 
-        mapsItor = maps.begin();
+        mapsItor = 0;
+        currentMap = MapId::find("player_room");
+    }
 
+    void OverworldData::loadTextures() {
+        using Utils::ResourceLoader;
+        ResourceLoader::load(texturePP, "sprites/chara/pp/pp_anim.png");
+        for(unsigned int i = 0; i < eventsTextures.size(); i++) {
+            if(!eventsTexturesPaths[i].empty()) {
+                ResourceLoader::load(eventsTextures[i], eventsTexturesPaths[i]);
+            }
+        }
+        for(unsigned int i = 0; i < tilesets.size(); i++) {
+            if(!tilesetsPaths[i].empty()) {
+                ResourceLoader::load(tilesets[i].first, tilesetsPaths[i]);
+            }
+        }
+        elementsAtlas.upload();
+        gameMenuData.loadTextures();
+
+        // The sprite of the player takes the size of its texture
         playerEvent = new Elements::PlayerEvent(*this);
     }
 
+    void OverworldData::preloadResources(Utils::LoadingProgress &progress) {
+        std::vector<std::function<void()>> images =
+            listImages(readResourceLists());
+        progress.addSteps(images.size());
+        for(auto const &preload : images) {
+            preload();
+            progress.advance();
+        }
+    }
+
     OverworldData::~OverworldData() {
         for(auto &map : maps) {
-            delete(map.second.second);
+            delete(map.second);
         }
         for(auto &pair : tilesets) {
-            free(pair.second.second);
+            free(pair.second);
         }
         delete(playerEvent);
     }
 
-    Elements::Map *OverworldData::getMap(std::string const &map) {
-        if(maps[map].second == nullptr) { // If the map has not been loaded yet
-            maps[map].second = new Elements::Map(
-                maps[map].first, *this); // Loads the map with the json data
+    Elements::Map *OverworldData::getMap(MapId map) {
+        if(map.getIndex() >= maps.size() ||
+           maps[map.getIndex()].first.is_null()) {
+            throw Utils::UnloadedResourceException(map.getName(),
+                                                   "OverworldData::getMap");
+        }
+        auto &entry = maps[map.getIndex()];
+        if(entry.second == nullptr) { // If the map has not been loaded yet
+            entry.second = new Elements::Map(
+                entry.first, *this); // Loads the map with the json data
+            if(map.getIndex() < pendingEventStates.size() &&
+               !pendingEventStates[map.getIndex()].empty()) {
+                std::vector<std::uint8_t> states =
+                    std::move(pendingEventStates[map.getIndex()]);
+                pendingEventStates[map.getIndex()].clear();
+                setEventStates(map, states);
+            }
         }
-        return maps[map].second;
+        return entry.second;
     }
 
-    Elements::Map *OverworldData::getCurrentMap() { return getMap(currentMap); }
-
-    sf::Texture &OverworldData::getEventsTexture(
-        std::string const
-            &key) { // Uncomment commented lines when C++20 is commonly used
-        //#if __cplusplus > 201703L
-        // if(!eventsTextures.contains(key)){
-        //#else
-        bool contains = false;
-        for(std::pair<std::string, sf::Texture> pair : eventsTextures) {
-            if(pair.first == key) {
-                contains = true;
-                break;
+    std::vector<std::uint8_t> OverworldData::getEventStates(MapId map) {
+        std::vector<std::uint8_t> states;
+        if(map.getIndex() < maps.size() &&
+           maps[map.getIndex()].second != nullptr) {
+            states = maps[map.getIndex()].second->getEventStates();
+        } else if(map.getIndex() < pendingEventStates.size()) {
+            states = pendingEventStates[map.getIndex()];
+        }
+        return states;
+    }
+
+    void OverworldData::setEventStates(MapId map,
+                                       std::vector<std::uint8_t> const &states) {
+        if(!map.isValid()) {
+            return;
+        }
+        if(map.getIndex() < maps.size() &&
+           maps[map.getIndex()].second != nullptr) {
+            maps[map.getIndex()].second->setEventStates(states);
+        } else {
+            if(map.getIndex() >= pendingEventStates.size()) {
+                pendingEventStates.resize(map.getIndex() + 1);
             }
+            pendingEventStates[map.getIndex()] = states;
         }
-        if(!contains) {
-            //#endif
-            Utils::Log::warn("Event texture key " + key +
+    }
+
+    sf::Texture const &
+        OverworldData::getEventsTexture(EventTextureId id) const {
+        if(id.getIndex() >= eventsTextures.size()) {
+            Utils::Log::warn("Event texture key " + id.getName() +
                              " not found. Returning alpha.");
             return alpha;
-        } else
-            return eventsTextures[key];
+        }
+        return eventsTextures[id.getIndex()];
     }
 
 } // namespace OpMon
@@ -7,9 +7,13 @@
 
 #include <SFML/Graphics/Rect.hpp>
 
+#include "src/opmon/core/Ids.hpp"
+#include "src/opmon/screens/battle/BattleData.hpp"
 #include "src/opmon/screens/gamemenu/GameMenuData.hpp"
 #include "src/opmon/view/elements/Map.hpp"
 #include "src/opmon/view/elements/events/PlayerEvent.hpp"
+#include "src/utils/LoadingProgress.hpp"
+#include "src/utils/TextureAtlas.hpp"
 #include "src/utils/defines.hpp"
 
 namespace sf {
@@ -24,6 +28,25 @@ namespace OpMon {
         class Map;
     } // namespace Elements
 
+    /*!
+     * \brief The definition of an animated element, shared by all the maps showing it.
+     */
+    struct ElementData {
+        sf::Vector2f position;
+        /*!
+         * \brief The index of the first frame in the atlas of the elements. The other frames follow it.
+         */
+        unsigned int firstFrame = 0;
+        /*!
+         * \brief The number of frames, 0 if the element hasn't been loaded.
+         */
+        unsigned int frameCount = 0;
+        /*!
+         * \brief The number of ticks each frame is shown.
+         */
+        unsigned int frameTicks = 1;
+    };
+
     /*!
      * \brief Contains the data used for the Overworld.
      */
@@ -35,17 +58,28 @@ namespace OpMon {
         std::map<std::string, OpTeam *> trainers;
 
         /*!
-         * \brief Contains the maps.
+         * \brief Contains the maps, indexed by MapId.
          *
          * The first element of the pair contains the json used to build the
          * map. The second element contains the built map, or nullptr if the map
          * has not been initialized yet.
          */
-        std::map<std::string, std::pair<nlohmann::json, Elements::Map *>> maps;
-        std::map<std::string,
-                 std::pair<nlohmann::json, Elements::Map *>>::iterator mapsItor;
+        std::vector<std::pair<nlohmann::json, Elements::Map *>> maps;
+        /*!
+         * \brief The ids of the maps found in the data files, in loading order.
+         */
+        std::vector<MapId> mapIds;
+        /*!
+         * \brief The position of the map iterator in OverworldData::mapIds.
+         */
+        size_t mapsItor = 0;
+
+        MapId currentMap;
 
-        std::string currentMap = "player_room";
+        /*!
+         * \brief The event states restored by setEventStates() for the maps not loaded yet, indexed by MapId.
+         */
+        std::vector<std::vector<std::uint8_t>> pendingEventStates;
 
         sf::Texture texturePP;
         std::vector<sf::IntRect> texturePPRect;
@@ -54,75 +88,85 @@ namespace OpMon {
 
         Player *player;
 
-        std::map<std::string, sf::Vector2f> elementsPos;
-        std::map<std::string, unsigned int> elementsCounter;
-        std::map<std::string, std::vector<sf::Texture>> elementsTextures;
+        /*!
+         * \brief The animated elements, indexed by ElementId.
+         */
+        std::vector<ElementData> elements;
+
+        /*!
+         * \brief The frames of all the animated elements.
+         * \details The frames of an element are in the same page, so they can be drawn in the same batch.
+         */
+        Utils::TextureAtlas elementsAtlas;
 
-        std::map<std::string, sf::Texture> eventsTextures;
+        /*!
+         * \brief The textures of the events, indexed by EventTextureId.
+         * \details The events point to these textures, so the vector must not be resized once the maps are loaded.
+         */
+        std::vector<sf::Texture> eventsTextures;
+        /*!
+         * \brief The paths of OverworldData::eventsTextures, loaded by loadTextures().
+         */
+        std::vector<std::string> eventsTexturesPaths;
 
-        std::map<std::string, std::unique_ptr<Item>> itemsList;
+        /*!
+         * \brief The items, indexed by ItemId.
+         */
+        std::vector<std::unique_ptr<Item>> itemsList;
 
         std::map<std::string, sf::String *> completions;
 
         /*!
-         * \brief Contains the tilesets.
+         * \brief Contains the tilesets, indexed by TilesetId.
          *
          * The first element of the pair represents the texture of the tileset,
          * the second represents the array of collisions.
          */
-        std::map<std::string, std::pair<sf::Texture, int *>> tilesets;
+        std::vector<std::pair<sf::Texture, int *>> tilesets;
+        /*!
+         * \brief The paths of the textures of OverworldData::tilesets, loaded by loadTextures().
+         */
+        std::vector<std::string> tilesetsPaths;
 
         GameMenuData gameMenuData;
 
+        BattleData battleData;
+
         /*!
          * \brief The copy constructor. Not defined, must not be used.
          */
         OverworldData(OverworldData const &);
 
-        Elements::PlayerEvent *playerEvent;
+        Elements::PlayerEvent *playerEvent = nullptr;
 
       public:
         /*!
-         * \brief Increments the animation counter for an element.
-         */
-        void incrementElementCounter(std::string const &elementId) {
-            elementsCounter[elementId]++;
-        }
-        /*!
-         * \brief Resets the animation counter for an element.
+         * \brief Checks if an element has been loaded.
+         * \details getElement() must only be called with a loaded element.
          */
-        void resetElementCounter(std::string const &id) {
-            elementsCounter[id] = 0;
+        bool hasElement(ElementId id) const {
+            return id.getIndex() < elements.size() &&
+                   elements[id.getIndex()].frameCount != 0;
         }
-        /*!
-         * \brief Gets the animation counter for an element.
-         */
-        unsigned int getElementCounter(std::string const &id) {
-            return elementsCounter[id];
+        ElementData const &getElement(ElementId id) const {
+            return elements[id.getIndex()];
         }
-        /*!
-         * \brief Gets the textures of an element.
-         */
-        std::vector<sf::Texture> &getElementTextures(std::string const &id) {
-            return elementsTextures[id];
-        }
-        /*!
-         * \brief Gets the position of an element.
-         */
-        sf::Vector2f &getElementPos(std::string const &id) {
-            return elementsPos[id];
+        Utils::TextureAtlas const &getElementsAtlas() const {
+            return elementsAtlas;
         }
+
         /*!
-         * \brief Gets the current shown texture of an element.
+         * \brief Gets the textures of an event.
+         * \returns The texture, or an empty texture if the id is unknown.
          */
-        sf::Texture &getCurrentElementTexture(std::string const &id) {
-            return elementsTextures[id][elementsCounter[id]];
-        }
-
+        sf::Texture const &getEventsTexture(EventTextureId id) const;
         /*!
          * \brief Gets the textures of an event.
+         * \details Resolves the key with EventTextureId::find, to be used when loading events.
          */
-        sf::Texture &getEventsTexture(std::string const &key);
+        sf::Texture const &getEventsTexture(std::string const &key) const {
+            return getEventsTexture(EventTextureId::find(key));
+        }
 
         /*!
          * \brief Gets a completion.
@@ -142,43 +186,66 @@ namespace OpMon {
          */
         GameMenuData &getGameMenuData() { return gameMenuData; }
 
+        /*!
+         * \brief The data of the battles, kept between the battles.
+         */
+        BattleData &getBattleData() { return battleData; }
+
         /*!
          * \brief Gets a map.
          */
-        Elements::Map *getMap(std::string const &map);
+        Elements::Map *getMap(MapId map);
         /*!
          * \brief Gets the current map.
          */
-        Elements::Map *getCurrentMap();
+        Elements::Map *getCurrentMap() { return getMap(currentMap); }
         /*!
          * \brief Sets the current map.
          */
-        void setCurrentMap(std::string map) { currentMap = map; }
+        void setCurrentMap(MapId map) { currentMap = map; }
+        MapId getCurrentMapId() const { return currentMap; }
+
+        /*!
+         * \brief Returns the ids of all the maps, in loading order.
+         */
+        std::vector<MapId> const &getMapIds() const { return mapIds; }
+
+        /*!
+         * \brief Returns the save states of the events of a map (see Elements::AbstractEvent::getSaveState()).
+         * \returns The states, in the order of Elements::Map::getEvents(). Empty if the map has not been loaded and no state has been restored for it.
+         */
+        std::vector<std::uint8_t> getEventStates(MapId map);
+        /*!
+         * \brief Restores the save states of the events of a map.
+         * \details If the map has not been loaded yet, the states are kept and restored when it is.
+         */
+        void setEventStates(MapId map, std::vector<std::uint8_t> const &states);
 
         /*!
          * \brief Gets the id of the map currently pointer by the map iterator.
          * \details The map iterator is used to go through all the maps in debug mode.
          */
-        std::string getCurrentItorMap() { return mapsItor->first; }
+        MapId getCurrentItorMap() const {
+            return mapIds.empty() ? MapId() : mapIds[mapsItor];
+        }
         /*!
          * \brief Increments the map iterator.
          * \details See OverworldData::getCurrentItorMap for more information on the map iterator.
          */
         void incrementItorMap() {
             mapsItor++;
-            if(mapsItor == maps.end())
-                mapsItor = maps.begin();
+            if(mapsItor >= mapIds.size())
+                mapsItor = 0;
         }
         /*!
          * \brief Decrements the map iterator.
          * \details See OverworldData::getCurrentItorMap for more information on the map iterator.
          */
         void decrementItorMap() {
-            if(mapsItor != maps.begin())
+            if(mapsItor != 0)
                 mapsItor--;
-            else {
-                mapsItor = maps.end();
-                --mapsItor;
+            else if(!mapIds.empty()) {
+                mapsItor = mapIds.size() - 1;
             }
         }
 
@@ -229,29 +296,57 @@ namespace OpMon {
         /*!
          * \brief Gets an item.
          */
-        std::unique_ptr<Item> &getItem(std::string const &str) {
-            return itemsList[str];
+        Item *getItem(ItemId id) {
+            return id.getIndex() < itemsList.size()
+                       ? itemsList[id.getIndex()].get()
+                       : nullptr;
         }
 
         /*!
          * \brief Returns a tileset.
+         * \returns The texture of the tileset, or an empty texture if the id is unknown.
          */
-        sf::Texture &getTileset(std::string id) { return tilesets[id].first; }
+        sf::Texture &getTileset(TilesetId id) {
+            return id.getIndex() < tilesets.size()
+                       ? tilesets[id.getIndex()].first
+                       : alpha;
+        }
 
         /*!
          * \brief Returns the collision array for a tileset.
+         * \returns The array, or nullptr if the id is unknown.
          */
-        int *getTilesetCol(std::string id) { return tilesets[id].second; }
+        int *getTilesetCol(TilesetId id) {
+            return id.getIndex() < tilesets.size()
+                       ? tilesets[id.getIndex()].second
+                       : nullptr;
+        }
 
         Elements::PlayerEvent &getPlayerEvent() { return *playerEvent; }
 
         /*!
-         * \brief Initialises all the data.
+         * \brief Initialises all the data, except the textures.
+         * \details Reads the moves, the items, the trainers and the maps, and decodes the images of the textures (see Utils::ResourceLoader::preloadImage()). It doesn't use the graphics context, so it is called from the worker thread of AGameScreen::prepareNextScreen(). loadTextures() must then be called from the main thread before using the data. The maps themselves are built when they are first used, as their events need the textures.
          * \param data A pointer to the GameData object.
          * \param player A pointer to the Player object.
+         * \param progress Receives one step per data file and per image.
          */
-        OverworldData(GameData *gamedata, Player *player);
+        OverworldData(GameData *gamedata, Player *player,
+                      Utils::LoadingProgress &progress);
         ~OverworldData();
+
+        /*!
+         * \brief Sends the images decoded by the constructor to the graphics card.
+         * \details Must be called once, from the main thread.
+         */
+        void loadTextures();
+
+        /*!
+         * \brief Decodes the images of the textures loaded by the constructor (see Utils::ResourceLoader::preloadImage()).
+         * \details Doesn't use the graphics context, so it can be called from a worker thread before constructing the data, to start decoding the images earlier.
+         * \param progress Receives one step per image.
+         */
+        static void preloadResources(Utils::LoadingProgress &progress);
     };
 
 } // namespace OpMon
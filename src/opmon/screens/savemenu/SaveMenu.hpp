@@ -50,6 +50,15 @@ namespace OpMon {
 
         void switchCursorConfirmationOption();
 
+        /*!
+         * \brief Returns the index of the selected file.
+         */
+        int getCursorPosition() const { return currentCursorPosition; }
+
+        SaveMenuConfirmationOption getConfirmationOption() const {
+            return currentCursorConfirmationOption;
+        }
+
       private:
         SaveMenuData &data;
 
@@ -1,11 +1,27 @@
 #include "SaveMenuCtrl.hpp"
 
+#include <utility>
+
 #include "SaveMenu.hpp"
+#include "src/opmon/core/system/path.hpp"
+#include "src/opmon/screens/overworld/OverworldCtrl.hpp"
+#include "src/opmon/view/ui/Jukebox.hpp"
+#include "src/utils/exceptions.hpp"
+#include "src/utils/log.hpp"
 
 namespace OpMon {
 
-    SaveMenuCtrl::SaveMenuCtrl(GameData *data, SaveMenuContext context)
-        : data(data), view(this->data, context) {}
+    SaveMenuCtrl::SaveMenuCtrl(GameData *data, SaveMenuContext context,
+                               std::shared_ptr<const SaveGame::State> save)
+        : data(data),
+          view(this->data, context),
+          context(context),
+          save(std::move(save)) {}
+
+    std::string SaveMenuCtrl::getFilePath(int file) {
+        return Path::getSavePath() + "file" + std::to_string(file + 1) +
+               ".opsave";
+    }
 
     GameStatus SaveMenuCtrl::checkEvent(sf::Event const &event) {
         auto &menu = view;
@@ -34,6 +50,10 @@ namespace OpMon {
                     } else if(menu.getCurrentState() ==
                               SaveMenuState::FILE_CONFIRMATION) {
                         menu.setCurrentState(SaveMenuState::FILE_SELECTION);
+                        if(menu.getConfirmationOption() ==
+                           SaveMenuConfirmationOption::YES) {
+                            return confirm();
+                        }
                     }
                 } else if(event.key.code == sf::Keyboard::BackSpace) {
                     return GameStatus::PREVIOUS;
@@ -42,9 +62,49 @@ namespace OpMon {
         return GameStatus::CONTINUE;
     }
 
+    GameStatus SaveMenuCtrl::confirm() {
+        std::string path = getFilePath(view.getCursorPosition());
+        Ui::Jukebox &jukebox = data.getGameDataPtr()->getJukebox();
+        if(context == SaveMenuContext::SAVING) {
+            if(save == nullptr) {
+                jukebox.playSound("nope");
+                return GameStatus::CONTINUE;
+            }
+            SaveGame::getInstance().write(save, path);
+            jukebox.playSound("push");
+            return GameStatus::CONTINUE;
+        }
+
+        // The file may still be written in the background
+        SaveGame::getInstance().flush();
+        try {
+            save = std::make_shared<const SaveGame::State>(
+                SaveGame::read(path));
+        } catch(Utils::LoadingException &e) {
+            Utils::Log::warn(e.desc());
+            jukebox.playSound("nope");
+            return GameStatus::CONTINUE;
+        }
+        jukebox.playSound("push");
+        return GameStatus::NEXT;
+    }
+
+    void SaveMenuCtrl::prepareNextScreen(Utils::LoadingProgress &progress) {
+        // A new player each time, so that a save which fails to be applied
+        // leaves nothing behind
+        player = std::make_unique<Player>();
+        overworldData = OverworldCtrl::prepareData(
+            *player, data.getGameDataPtr(), save.get(), progress);
+    }
+
+    void SaveMenuCtrl::loadNextScreen() {
+        _next_gs = std::make_unique<OverworldCtrl>(
+            *player, std::move(overworldData), save.get());
+    }
+
     GameStatus SaveMenuCtrl::update(sf::RenderTexture &frame) {
         GameStatus status = view.update();
-        frame.draw(view);
+        drawView(frame, view);
         return status;
     }
 
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "SaveMenu.hpp"
+#include "src/opmon/core/Player.hpp"
+#include "src/opmon/core/SaveGame.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/opmon/screens/overworld/OverworldData.hpp"
 
 namespace sf {
     class Event;
@@ -14,16 +20,63 @@ namespace OpMon {
 
     class SaveMenuCtrl : public AGameScreen {
       public:
-        SaveMenuCtrl(GameData *data, SaveMenuContext context);
+        /*!
+         * \param save The state of the game to write in the selected file, if `context` is SaveMenuContext::SAVING.
+         */
+        SaveMenuCtrl(GameData *data, SaveMenuContext context,
+                     std::shared_ptr<const SaveGame::State> save = nullptr);
 
         GameStatus checkEvent(sf::Event const &event) override;
 
         GameStatus update(sf::RenderTexture &frame) override;
+        /*!
+         * \brief The menu only changes when a key is pressed.
+         */
+        bool isDirty() const override { return false; }
+
+        /*!
+         * \brief Prepares the data of the overworld with the loaded save applied.
+         * \throws Utils::LoadingException If the save can't be applied.
+         */
+        void prepareNextScreen(Utils::LoadingProgress &progress) override;
+        /*!
+         * \brief Resumes the loaded save in the overworld.
+         */
+        void loadNextScreen() override;
+
+        /*!
+         * \brief Returns the path of a save file.
+         * \param file The index of the file in the menu.
+         */
+        static std::string getFilePath(int file);
 
       private:
+        /*!
+         * \brief Saves in or loads the selected file, once the player has confirmed it.
+         * \returns GameStatus::NEXT if a save has been loaded.
+         */
+        GameStatus confirm();
+
         SaveMenuData data;
 
         SaveMenu view;
+
+        SaveMenuContext context;
+
+        /*!
+         * \brief The state to save, or the loaded state.
+         */
+        std::shared_ptr<const SaveGame::State> save;
+
+        /*!
+         * \brief The player of the loaded save.
+         */
+        std::unique_ptr<Player> player;
+
+        /*!
+         * \brief The data of the overworld, prepared in prepareNextScreen().
+         */
+        std::unique_ptr<OverworldData> overworldData;
     };
 
 } // namespace OpMon
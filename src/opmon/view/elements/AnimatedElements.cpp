@@ -0,0 +1,98 @@
+/*
+AnimatedElements.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "AnimatedElements.hpp"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+
+#include "src/opmon/screens/overworld/OverworldData.hpp"
+#include "src/utils/TextureAtlas.hpp"
+
+namespace OpMon {
+    namespace Elements {
+
+        void AnimatedElements::build(std::vector<ElementId> const &elements,
+                                     OverworldData const &data) {
+            atlas = &data.getElementsAtlas();
+            std::vector<ElementData const *> loaded;
+            for(ElementId element : elements) {
+                if(data.hasElement(element)) {
+                    loaded.push_back(&data.getElement(element));
+                }
+            }
+            // Sorted by page, so that each page is drawn in one batch
+            auto page = [this](ElementData const *element) {
+                return atlas->getRegion(element->firstFrame).page;
+            };
+            std::stable_sort(loaded.begin(), loaded.end(),
+                             [&page](ElementData const *a,
+                                     ElementData const *b) {
+                                 return page(a) < page(b);
+                             });
+
+            frames.assign(loaded.size(), 0);
+            timers.assign(loaded.size(), 0);
+            frameTicks.resize(loaded.size());
+            frameCounts.resize(loaded.size());
+            firstFrames.resize(loaded.size());
+            positions.resize(loaded.size());
+            quads.resize(loaded.size() * 4);
+            batches.clear();
+            for(unsigned int i = 0; i < loaded.size(); i++) {
+                frameTicks[i] = loaded[i]->frameTicks;
+                frameCounts[i] = loaded[i]->frameCount;
+                firstFrames[i] = loaded[i]->firstFrame;
+                positions[i] = loaded[i]->position;
+                updateQuad(i);
+
+                sf::Texture const *texture = &atlas->getPage(page(loaded[i]));
+                if(batches.empty() || batches.back().texture != texture) {
+                    batches.push_back({texture, i * 4, 0});
+                }
+                batches.back().vertexCount += 4;
+            }
+        }
+
+        void AnimatedElements::update() {
+            for(unsigned int i = 0; i < frames.size(); i++) {
+                if(++timers[i] < frameTicks[i]) {
+                    continue;
+                }
+                timers[i] = 0;
+                frames[i] = frames[i] + 1 < frameCounts[i] ? frames[i] + 1 : 0;
+                updateQuad(i);
+            }
+        }
+
+        void AnimatedElements::updateQuad(unsigned int element) {
+            sf::IntRect const &rect =
+                atlas->getRegion(firstFrames[element] + frames[element]).rect;
+            sf::Vector2f position = positions[element];
+            sf::Vector2f size(rect.width, rect.height);
+            sf::Vector2f texture(rect.left, rect.top);
+
+            sf::Vertex *quad = &quads[element * 4];
+            quad[0].position = position;
+            quad[1].position = position + sf::Vector2f(size.x, 0);
+            quad[2].position = position + size;
+            quad[3].position = position + sf::Vector2f(0, size.y);
+            quad[0].texCoords = texture;
+            quad[1].texCoords = texture + sf::Vector2f(size.x, 0);
+            quad[2].texCoords = texture + size;
+            quad[3].texCoords = texture + sf::Vector2f(0, size.y);
+        }
+
+        void AnimatedElements::draw(sf::RenderTarget &target,
+                                    sf::RenderStates states) const {
+            for(Batch const &batch : batches) {
+                states.texture = batch.texture;
+                target.draw(&quads[batch.firstVertex], batch.vertexCount,
+                            sf::Quads, states);
+            }
+        }
+
+    } // namespace Elements
+} // namespace OpMon
@@ -0,0 +1,88 @@
+/*!
+ * \file AnimatedElements.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <vector>
+
+#include "src/opmon/core/Ids.hpp"
+
+namespace sf {
+    class Texture;
+} // namespace sf
+
+namespace Utils {
+    class TextureAtlas;
+} // namespace Utils
+
+namespace OpMon {
+    class OverworldData;
+
+    namespace Elements {
+
+        /*!
+         * \brief Animates and draws the animated elements of a map.
+         * \details The elements are resolved once, when the map is shown, into arrays holding the state of all the elements: update() then advances all of them in one loop, without looking anything up. Their frames are taken from the atlas of OverworldData, and the elements are drawn as quads of a vertex array, with one draw call per page of the atlas.
+         */
+        class AnimatedElements : public sf::Drawable {
+          public:
+            /*!
+             * \brief Prepares the elements of a map.
+             * \param elements The elements of the map (see Map::getAnimatedElements()). The elements which haven't been loaded are ignored.
+             */
+            void build(std::vector<ElementId> const &elements,
+                       OverworldData const &data);
+
+            /*!
+             * \brief Advances the animation of all the elements by one tick.
+             */
+            void update();
+
+            /*!
+             * \returns The number of draw calls made by draw().
+             */
+            unsigned int getDrawCalls() const { return batches.size(); }
+
+          private:
+            void draw(sf::RenderTarget &target,
+                      sf::RenderStates states) const override;
+
+            /*!
+             * \brief Updates the quad of an element to show its current frame.
+             */
+            void updateQuad(unsigned int element);
+
+            /*!
+             * \name State of the elements
+             * \brief One entry per element, in the order of the quads.
+             */
+            ///@{
+            std::vector<unsigned int> frames;
+            std::vector<unsigned int> timers;
+            std::vector<unsigned int> frameTicks;
+            std::vector<unsigned int> frameCounts;
+            std::vector<unsigned int> firstFrames;
+            std::vector<sf::Vector2f> positions;
+            ///@}
+
+            Utils::TextureAtlas const *atlas = nullptr;
+
+            sf::VertexArray quads {sf::Quads};
+
+            /*!
+             * \brief Consecutive elements drawn with the same page of the atlas.
+             */
+            struct Batch {
+                sf::Texture const *texture;
+                unsigned int firstVertex;
+                unsigned int vertexCount;
+            };
+            std::vector<Batch> batches;
+        };
+
+    } // namespace Elements
+} // namespace OpMon
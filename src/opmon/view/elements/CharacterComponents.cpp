@@ -0,0 +1,242 @@
+/*
+CharacterComponents.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "CharacterComponents.hpp"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+#include <functional>
+
+#include "Map.hpp"
+#include "Pathfinder.hpp"
+#include "src/opmon/screens/overworld/Overworld.hpp"
+
+namespace OpMon {
+    namespace Elements {
+
+        namespace {
+            int sideFlag(Side dir) {
+                switch(dir) {
+                    case Side::TO_UP:
+                        return SIDE_UP;
+                    case Side::TO_DOWN:
+                        return SIDE_DOWN;
+                    case Side::TO_LEFT:
+                        return SIDE_LEFT;
+                    case Side::TO_RIGHT:
+                        return SIDE_RIGHT;
+                    default:
+                        return 0;
+                }
+            }
+        } // namespace
+
+        void CharacterComponents::setMapSize(int w, int h) {
+            this->w = w;
+            this->h = h;
+            blockers.assign(w * h, 0);
+        }
+
+        void CharacterComponents::add(OverworldData &data,
+                                      nlohmann::json const &jsonData) {
+            std::vector<int> position =
+                jsonData.value("position", std::vector<int> {0, 0});
+            sf::Vector2i tile(position[0], position[1]);
+            Side dir = jsonData.value("facing", Side::TO_DOWN);
+
+            tiles.push_back(tile);
+            positions.push_back(32.0f * sf::Vector2f(tile.x, tile.y) +
+                                sf::Vector2f(16, 0));
+            facing.push_back(dir);
+
+            moveStyles.push_back(
+                jsonData.value("moveStyle", MoveStyle::NO_MOVE));
+            steps.push_back(Side::STAY);
+            stepTicks.push_back(-1);
+            walking.push_back(false);
+            unsigned int pathStart = pathSteps.size();
+            for(nlohmann::json const &step :
+                jsonData.value("path", nlohmann::json::array())) {
+                for(unsigned int r = 0; r < step.at(1); r++) {
+                    pathSteps.push_back(step.at(0));
+                }
+            }
+            paths.emplace_back(pathStart, pathSteps.size() - pathStart);
+            pathCounters.push_back(0);
+
+            animTicks.push_back(0);
+            rects.push_back(Npc::frameRect(dir, Npc::STAND_STILL));
+            textures.push_back(
+                &data.getEventsTexture(jsonData.at("textures")));
+
+            triggers.push_back(
+                jsonData.value("trigger", EventTrigger::PRESS));
+            sides.push_back(jsonData.value("side", SIDE_ALL));
+            passable.push_back(jsonData.value("passable", true));
+            turns.push_back(Side::NO_MOVE);
+            if(!passable.back() && inMap(tile)) {
+                blockers[tile.x + tile.y * w]++;
+            }
+
+            drawOrder.push_back(tiles.size() - 1);
+        }
+
+        void CharacterComponents::sortDrawOrder() {
+            std::stable_sort(drawOrder.begin(), drawOrder.end(),
+                             [this](unsigned int a, unsigned int b) {
+                                 return std::less<sf::Texture const *>()(
+                                     textures[a], textures[b]);
+                             });
+        }
+
+        bool CharacterComponents::isBlocking(sf::Vector2i tile) const {
+            return inMap(tile) && blockers[tile.x + tile.y * w] != 0;
+        }
+
+        bool CharacterComponents::startStep(unsigned int npc, Side dir,
+                                            Map &map, sf::Vector2i player) {
+            stepTicks[npc] = 0;
+            walking[npc] = false;
+            if(dir == Side::NO_MOVE || dir == Side::STAY) {
+                steps[npc] = Side::STAY;
+                return true;
+            }
+            steps[npc] = dir;
+            facing[npc] = dir;
+
+            sf::Vector2i next = tiles[npc] + Npc::offset(dir);
+            if(!map.getPathfinder().canMove(tiles[npc], dir) ||
+               next == player || isBlocking(next)) {
+                return false;
+            }
+            for(AbstractEvent *event : map.getEvent(next)) {
+                if(!event->isPassable()) {
+                    return false;
+                }
+            }
+            if(!passable[npc]) {
+                blockers[tiles[npc].x + tiles[npc].y * w]--;
+                blockers[next.x + next.y * w]++;
+            }
+            tiles[npc] = next;
+            walking[npc] = true;
+            return true;
+        }
+
+        void CharacterComponents::update(Overworld &overworld) {
+            Map &map = *overworld.getData().getCurrentMap();
+            sf::Vector2i player =
+                overworld.getCharacter().getPositionMap().getPosition();
+
+            // Movements
+            for(unsigned int i = 0; i < tiles.size(); i++) {
+                if(stepTicks[i] >= 0) {
+                    continue;
+                }
+                auto [first, count] = paths[i];
+                Npc::Step step =
+                    Npc::chooseStep(moveStyles[i], tiles[i], player, map,
+                                    pathSteps.data() + first, count,
+                                    pathCounters[i]);
+                if(!step.move) {
+                    if(step.dir != Side::STAY) {
+                        facing[i] = step.dir;
+                        rects[i] = Npc::frameRect(step.dir, Npc::STAND_STILL);
+                    }
+                } else if(!startStep(i, step.dir, map, player)) {
+                    Npc::cancelStep(moveStyles[i], pathCounters[i], count);
+                }
+            }
+
+            // Animations and steps
+            for(unsigned int i = 0; i < tiles.size(); i++) {
+                if(stepTicks[i] < 0) {
+                    continue;
+                }
+                if(steps[i] != Side::STAY) {
+                    rects[i] = Npc::frameRect(steps[i],
+                                              Npc::walkRow(animTicks[i]));
+                }
+                if(walking[i]) {
+                    positions[i] += 4.0f * sf::Vector2f(Npc::offset(steps[i]));
+                }
+                if(++stepTicks[i] >= Npc::STEP_TICKS) {
+                    stepTicks[i] = -1;
+                    steps[i] = Side::STAY;
+                    walking[i] = false;
+                    rects[i] = Npc::frameRect(facing[i], Npc::STAND_STILL);
+                }
+            }
+
+            // Npcs turning to the player
+            for(unsigned int i = 0; i < tiles.size(); i++) {
+                if(turns[i] != Side::NO_MOVE && stepTicks[i] < 0) {
+                    facing[i] = turns[i];
+                    rects[i] = Npc::frameRect(facing[i], Npc::STAND_STILL);
+                    turns[i] = Side::NO_MOVE;
+                }
+            }
+        }
+
+        void CharacterComponents::trigger(sf::Vector2i tile,
+                                          EventTrigger trigger,
+                                          Side playerDir) {
+            Side toPlayer = Npc::opposite(playerDir);
+            if(toPlayer == Side::NO_MOVE) {
+                return;
+            }
+            for(unsigned int i = 0; i < tiles.size(); i++) {
+                if(tiles[i] == tile && triggers[i] == trigger &&
+                   (sides[i] & sideFlag(playerDir)) != 0) {
+                    turns[i] = toPlayer;
+                }
+            }
+        }
+
+        void CharacterComponents::updateQuads(float playerY) {
+            for(unsigned int layer = 0; layer < 2; layer++) {
+                quads[layer].clear();
+                batches[layer].clear();
+            }
+            for(unsigned int i : drawOrder) {
+                unsigned int layer = positions[i].y > playerY ? 1 : 0;
+                std::vector<Batch> &layerBatches = batches[layer];
+                if(layerBatches.empty() ||
+                   layerBatches.back().texture != textures[i]) {
+                    layerBatches.push_back(
+                        {textures[i], (unsigned int)quads[layer].size(), 0});
+                }
+                layerBatches.back().vertexCount += 4;
+
+                // The sprites are scaled by 2 around their center, see
+                // CharacterEvent
+                sf::Vector2f center = positions[i];
+                sf::IntRect const &rect = rects[i];
+                sf::Vector2f texture(rect.left, rect.top);
+                sf::Vector2f size(rect.width, rect.height);
+                quads[layer].emplace_back(center - size, texture);
+                quads[layer].emplace_back(
+                    center + sf::Vector2f(size.x, -size.y),
+                    texture + sf::Vector2f(size.x, 0));
+                quads[layer].emplace_back(center + size, texture + size);
+                quads[layer].emplace_back(
+                    center + sf::Vector2f(-size.x, size.y),
+                    texture + sf::Vector2f(0, size.y));
+            }
+        }
+
+        unsigned int CharacterComponents::draw(sf::RenderTarget &target,
+                                               bool abovePlayer) const {
+            sf::RenderStates states;
+            for(Batch const &batch : batches[abovePlayer]) {
+                states.texture = batch.texture;
+                target.draw(&quads[abovePlayer][batch.firstVertex],
+                            batch.vertexCount, sf::Quads, states);
+            }
+            return batches[abovePlayer].size();
+        }
+
+    } // namespace Elements
+} // namespace OpMon
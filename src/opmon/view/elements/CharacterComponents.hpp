@@ -0,0 +1,187 @@
+/*!
+ * \file CharacterComponents.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "events/CharacterEvent.hpp"
+
+namespace sf {
+    class RenderTarget;
+    class Texture;
+} // namespace sf
+
+namespace OpMon {
+    class Overworld;
+    class OverworldData;
+
+    namespace Elements {
+
+        class Map;
+
+        /*!
+         * \brief The simple npcs of a map ("Character" events), stored as arrays of components.
+         * \details The npcs which only walk around and turn to face the player don't need to be objects: their position, their movement, their animation, their texture and their trigger are stored in arrays, one entry per npc, and updated by loops over these arrays. The events with a scripted behavior stay AbstractEvent objects.
+         *
+         * The npcs are drawn as quads of two vertex arrays (under and above the player), with one draw call per texture. The tiles blocked by the npcs are kept in a grid, so that checking a movement doesn't look at all the npcs.
+         */
+        class CharacterComponents {
+          public:
+            /*!
+             * \brief Sets the size of the map, in tiles. Must be called before adding npcs.
+             */
+            void setMapSize(int w, int h);
+
+            /*!
+             * \brief Adds a npc, with the same data as CharacterEvent.
+             * \details sortDrawOrder() must be called once all the npcs are added.
+             */
+            void add(OverworldData &data, nlohmann::json const &jsonData);
+
+            /*!
+             * \brief Sorts the npcs by texture, to draw them in batches.
+             */
+            void sortDrawOrder();
+
+            /*!
+             * \returns The number of npcs.
+             */
+            unsigned int size() const { return tiles.size(); }
+
+            /*!
+             * \brief Moves and animates all the npcs by one tick.
+             */
+            void update(Overworld &overworld);
+
+            /*!
+             * \brief Updates the quads of the npcs.
+             * \param playerY The vertical position of the player, in pixels, separating the npcs drawn under and above the player.
+             */
+            void updateQuads(float playerY);
+
+            /*!
+             * \brief Draws the npcs under or above the player.
+             * \returns The number of draw calls.
+             */
+            unsigned int draw(sf::RenderTarget &target, bool abovePlayer) const;
+
+            /*!
+             * \brief Triggers the npcs of a tile.
+             * \details The npcs with this trigger, and which can be triggered from this side, turn to face the player.
+             * \param playerDir The direction the player is facing.
+             */
+            void trigger(sf::Vector2i tile, EventTrigger trigger,
+                         Side playerDir);
+
+            /*!
+             * \returns `true` if a npc which isn't passable is on this tile, or is going on it.
+             */
+            bool isBlocking(sf::Vector2i tile) const;
+
+          private:
+            /*!
+             * \brief Starts a step of a npc.
+             * \details As with Position::move(), the npc plays the walking animation for one step even if the movement is impossible, and Side::NO_MOVE makes it wait for one step.
+             * \returns `false` if the movement is impossible.
+             */
+            bool startStep(unsigned int npc, Side dir, Map &map,
+                           sf::Vector2i player);
+
+            bool inMap(sf::Vector2i tile) const {
+                return tile.x >= 0 && tile.y >= 0 && tile.x < w && tile.y < h;
+            }
+
+            /*!
+             * \name Position
+             */
+            ///@{
+            std::vector<sf::Vector2i> tiles;
+            /*!
+             * \brief The position of the center of the sprites, in pixels.
+             */
+            std::vector<sf::Vector2f> positions;
+            std::vector<Side> facing;
+            ///@}
+
+            /*!
+             * \name Movement
+             */
+            ///@{
+            std::vector<MoveStyle> moveStyles;
+            /*!
+             * \brief The direction of the current step, Side::STAY if the npc isn't moving or is waiting.
+             */
+            std::vector<Side> steps;
+            /*!
+             * \brief The number of ticks since the start of the current step, -1 if the npc isn't in a step.
+             */
+            std::vector<int> stepTicks;
+            /*!
+             * \brief If the current step moves the npc (`false` if it is blocked).
+             */
+            std::vector<std::uint8_t> walking;
+            /*!
+             * \brief The predefined paths of the npcs, as {first step in Elements::CharacterComponents::pathSteps, number of steps}.
+             */
+            std::vector<std::pair<unsigned int, unsigned int>> paths;
+            std::vector<unsigned int> pathCounters;
+            std::vector<Side> pathSteps;
+            ///@}
+
+            /*!
+             * \name Animation
+             */
+            ///@{
+            /*!
+             * \brief Counts the ticks of the walking animation, which alternates the two steps of the texture (see Npc::walkRow()).
+             */
+            std::vector<int> animTicks;
+            std::vector<sf::IntRect> rects;
+            std::vector<sf::Texture const *> textures;
+            ///@}
+
+            /*!
+             * \name Trigger
+             */
+            ///@{
+            std::vector<EventTrigger> triggers;
+            std::vector<int> sides;
+            std::vector<std::uint8_t> passable;
+            /*!
+             * \brief The direction to turn to when the current step ends, Side::NO_MOVE if none.
+             */
+            std::vector<Side> turns;
+            ///@}
+
+            int w = 0;
+            int h = 0;
+            /*!
+             * \brief The number of npcs which aren't passable on each tile.
+             */
+            std::vector<std::uint16_t> blockers;
+
+            /*!
+             * \brief The npcs, sorted by texture to draw them in batches.
+             */
+            std::vector<unsigned int> drawOrder;
+
+            /*!
+             * \brief Consecutive quads drawn with the same texture.
+             */
+            struct Batch {
+                sf::Texture const *texture;
+                unsigned int firstVertex;
+                unsigned int vertexCount;
+            };
+            std::vector<sf::Vertex> quads[2];
+            std::vector<Batch> batches[2];
+        };
+
+    } // namespace Elements
+} // namespace OpMon
@@ -10,6 +10,7 @@ File under GNU GPL v3.0 license
 #include <sstream>
 
 #include "../../../utils/log.hpp"
+#include "Pathfinder.hpp"
 #include "events/AnimationEvent.hpp"
 #include "events/DialogEvent.hpp"
 #include "events/SoundEvent.hpp"
@@ -30,9 +31,8 @@ namespace OpMon {
 
         Map::Map(std::vector<int> const &layer1, std::vector<int> const &layer2,
                  std::vector<int> const &layer3, int w, int h, bool indoor,
-                 std::string const &tileset, int *tilesetCol,
-                 std::string const &bg,
-                 std::vector<std::string> const &animatedElements)
+                 TilesetId tileset, int *tilesetCol, MusicId bg,
+                 std::vector<ElementId> const &animatedElements)
             : indoor(indoor),
               bg(bg),
               animatedElements(animatedElements),
@@ -50,6 +50,7 @@ namespace OpMon {
 
             this->w = w;
             this->h = h;
+            characters.setMapSize(w, h);
         }
 
         Map::~Map() {
@@ -66,6 +67,7 @@ namespace OpMon {
 
             w = jsonData.at("size")[0];
             h = jsonData.at("size")[1];
+            characters.setMapSize(w, h);
 
             this->layer1 = (int *)malloc(sizeof(int) * w * h);
             this->layer2 = (int *)malloc(sizeof(int) * w * h);
@@ -78,21 +80,28 @@ namespace OpMon {
             }
 
             indoor = jsonData.at("indoor");
-            tileset = jsonData.at("tileset");
+            // The resources are loaded before the maps, so the ids are only
+            // looked up here. Unknown ids are kept invalid and reported when
+            // used.
+            tileset = TilesetId::find(jsonData.at("tileset"));
             tilesetCol = data.getTilesetCol(tileset);
-            bg = jsonData.at("music");
-            animatedElements =
-                jsonData.value("animations", std::vector<std::string>());
+            bg = MusicId::find(jsonData.at("music"));
+            for(std::string const &element :
+                jsonData.value("animations", std::vector<std::string>())) {
+                animatedElements.push_back(ElementId::find(element));
+            }
 
             for(nlohmann::json event : jsonData.at("events")) {
                 std::string type = event.at("type");
+                size_t eventCount = events.size();
                 if(type == "TP")
                     events.push_back(new TPEvent(data, event));
                 else if(type == "Animation")
                     events.push_back(new AnimationEvent(data, event));
-                else if(type == "Character")
-                    events.push_back(new CharacterEvent(data, event));
-                else if(type == "Dialog")
+                else if(type == "Character") {
+                    characters.add(data, event);
+                    saveSlots.push_back(-1);
+                } else if(type == "Dialog")
                     events.push_back(new DialogEvent(data, event));
                 else if(type == "Sound")
                     events.push_back(new SoundEvent(data, event));
@@ -106,7 +115,11 @@ namespace OpMon {
                     events.push_back(new DoorEvent(data, event));
                 else if(type == "LinearMeta")
                     events.push_back(new LinearMetaEvent(data, event));
+                if(events.size() != eventCount) {
+                    saveSlots.push_back(eventCount);
+                }
             }
+            characters.sortDrawOrder();
         }
 
         std::list<AbstractEvent *> Map::getEvent(sf::Vector2i position) const {
@@ -153,11 +166,34 @@ namespace OpMon {
             return (collisionLayer1 == 0) ? collisionLayer2 : collisionLayer1;
         }
 
+        std::vector<std::uint8_t> Map::getEventStates() const {
+            std::vector<std::uint8_t> states;
+            for(int slot : saveSlots) {
+                states.push_back(slot < 0 ? 0 : events[slot]->getSaveState());
+            }
+            return states;
+        }
+
+        void Map::setEventStates(std::vector<std::uint8_t> const &states) {
+            for(size_t i = 0; i < saveSlots.size() && i < states.size(); i++) {
+                if(saveSlots[i] >= 0) {
+                    events[saveSlots[i]]->setSaveState(states[i]);
+                }
+            }
+        }
+
+        Pathfinder &Map::getPathfinder() {
+            if(pathfinder == nullptr) {
+                pathfinder = std::make_unique<Pathfinder>(*this);
+            }
+            return *pathfinder;
+        }
+
         std::string Map::toDebugString() {
             std::ostringstream out;
             out << "[class Map]" << std::endl;
             out << "size : " << w << " ; " << h << std::endl;
-            out << "bg = " << bg << std::endl;
+            out << "bg = " << bg.getName() << std::endl;
             out << "indoor = " << indoor << std::endl;
             out << "layer1 size : " << sizeof(layer1) / 4 << std::endl;
             out << "layer2 size : " << sizeof(layer2) / 4 << std::endl;
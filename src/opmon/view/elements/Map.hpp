@@ -18,8 +18,11 @@
 
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <list>
+#include <memory>
 
 #include "../../../nlohmann/json.hpp"
+#include "CharacterComponents.hpp"
+#include "src/opmon/core/Ids.hpp"
 
 namespace sf {
     class RenderTexture;
@@ -32,6 +35,7 @@ namespace OpMon {
     namespace Elements {
 
         class AbstractEvent;
+        class Pathfinder;
 
         /*!
          * \brief Defines a specific place in a game, containing the event, the animated objects and the map layers.
@@ -51,7 +55,7 @@ namespace OpMon {
             /*!
              * \brief The ID of the background music.
              */
-            std::string bg;
+            MusicId bg;
 
             /*!
              * \brief Width of the map.
@@ -64,33 +68,50 @@ namespace OpMon {
 
             Map(Map const &toCopy) = delete;
 
+            /*!
+             * \brief The events with a scripted behavior.
+             * \details The simple npcs are stored in Map::characters.
+             */
             std::vector<AbstractEvent *> events;
+            /*!
+             * \brief The simple npcs of the map.
+             */
+            CharacterComponents characters;
+            /*!
+             * \brief For each event of the map, in the order of the map file, its index in Map::events, or -1 for the npcs stored in Map::characters.
+             * \details The saved states of the events are stored in this order, so that the save files don't depend on how the events are stored.
+             */
+            std::vector<int> saveSlots;
             /*!
              * \brief Contains the animated elements of the map.
              * \details An animated element is an animation put on the top of the map. For exemple, the wind turbine of Fauxbourg Euvi.
              */
-            std::vector<std::string> animatedElements;
+            std::vector<ElementId> animatedElements;
 
             /*!
              * \brief The ID of the tileset used in the map.
              */
-            std::string tileset;
+            TilesetId tileset;
 
             /*!
              * \brief The collisions of the tileset.
              */
             int *tilesetCol;
 
+            /*!
+             * \brief The pathfinder of the map, created when it is first used.
+             */
+            std::unique_ptr<Pathfinder> pathfinder;
+
           public:
             /*!
              * \brief Creates a map and loads it at the same time, with all the information needed.
              */
             Map(std::vector<int> const &layer1, std::vector<int> const &layer2,
                 std::vector<int> const &layer3, int w, int h, bool indoor,
-                std::string const &tileset, int *tilesetCol,
-                std::string const &bg,
-                std::vector<std::string> const &animatedElements =
-                    std::vector<std::string>());
+                TilesetId tileset, int *tilesetCol, MusicId bg,
+                std::vector<ElementId> const &animatedElements =
+                    std::vector<ElementId>());
             /*!
              * \brief Creates a map without loading it.
              * \details If you want to use the map, please call Map::loadMap before calling any other method.
@@ -104,9 +125,9 @@ namespace OpMon {
             const int *getLayer1() const { return layer1; }
             const int *getLayer2() const { return layer2; }
             const int *getLayer3() const { return layer3; }
-            std::string getBg() const { return bg; }
-            std::string getTileset() const { return tileset; }
-            const std::vector<std::string> &getAnimatedElements() const {
+            MusicId getBg() const { return bg; }
+            TilesetId getTileset() const { return tileset; }
+            const std::vector<ElementId> &getAnimatedElements() const {
                 return animatedElements;
             }
             /*!
@@ -114,7 +135,10 @@ namespace OpMon {
              * \param event A pointer to an event.
              * \warning The given event will be deleted at the destruction of the map.
              */
-            void addEvent(AbstractEvent *event) { events.push_back(event); }
+            void addEvent(AbstractEvent *event) {
+                saveSlots.push_back(events.size());
+                events.push_back(event);
+            }
             /*!
              * \brief Returns all the events in the given position.
              * \param position The position in which to search for event.
@@ -124,6 +148,18 @@ namespace OpMon {
              * \brief Returns all the events of the map.
              */
             std::vector<AbstractEvent *> &getEvents() { return events; }
+            /*!
+             * \brief Returns the simple npcs of the map.
+             */
+            CharacterComponents &getCharacters() { return characters; }
+            /*!
+             * \brief Returns the states of the events to save (see AbstractEvent::getSaveState()).
+             */
+            std::vector<std::uint8_t> getEventStates() const;
+            /*!
+             * \brief Restores the states returned by getEventStates().
+             */
+            void setEventStates(std::vector<std::uint8_t> const &states);
             /*!
              * \brief Updates the animated elements by incrementing the animation.
              * \param frame A reference to the frame of the game.
@@ -150,6 +186,12 @@ namespace OpMon {
              */
             int getCollision(sf::Vector2i const &pos) const;
 
+            /*!
+             * \brief Returns the pathfinder used by the npcs of the map.
+             * \details The collisions of the map are computed the first time the pathfinder is used.
+             */
+            Pathfinder &getPathfinder();
+
             /*!
              * \brief Returns a string containing information on the Map.
              */
@@ -0,0 +1,106 @@
+/*
+NpcBehavior.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "NpcBehavior.hpp"
+
+#include "Map.hpp"
+#include "Pathfinder.hpp"
+#include "src/utils/misc.hpp"
+
+namespace OpMon {
+    namespace Elements {
+        namespace Npc {
+
+            sf::IntRect frameRect(int frame) {
+                return sf::IntRect((frame * 32) % 128, (frame / 4) * 32, 32,
+                                   32);
+            }
+
+            sf::Vector2i offset(Side dir) {
+                switch(dir) {
+                    case Side::TO_UP:
+                        return sf::Vector2i(0, -1);
+                    case Side::TO_DOWN:
+                        return sf::Vector2i(0, 1);
+                    case Side::TO_LEFT:
+                        return sf::Vector2i(-1, 0);
+                    case Side::TO_RIGHT:
+                        return sf::Vector2i(1, 0);
+                    default:
+                        return sf::Vector2i(0, 0);
+                }
+            }
+
+            Side opposite(Side dir) {
+                switch(dir) {
+                    case Side::TO_UP:
+                        return Side::TO_DOWN;
+                    case Side::TO_DOWN:
+                        return Side::TO_UP;
+                    case Side::TO_LEFT:
+                        return Side::TO_RIGHT;
+                    case Side::TO_RIGHT:
+                        return Side::TO_LEFT;
+                    default:
+                        return Side::NO_MOVE;
+                }
+            }
+
+            int walkRow(int &animTicks) {
+                // The first step is shown one tick longer than the second
+                int row = animTicks <= STEP_TICKS ? ANIM_1 : ANIM_2;
+                animTicks = (animTicks + 1) % (2 * STEP_TICKS + 1);
+                return row;
+            }
+
+            Step chooseStep(MoveStyle style, sf::Vector2i tile,
+                            sf::Vector2i player, Map &map, Side const *path,
+                            unsigned int pathLength,
+                            unsigned int &pathCounter) {
+                switch(style) {
+                    case MoveStyle::NO_MOVE:
+                        break;
+                    case MoveStyle::PREDEFINED:
+                        if(pathLength == 0) {
+                            break;
+                        }
+                        // TODO : Add the possibility of disabling the loop,
+                        // for one-time movements
+                        pathCounter = (pathCounter + 1) % pathLength;
+                        return {path[pathCounter], true};
+                    case MoveStyle::RANDOM: {
+                        // Only the movements allowed by the tiles are chosen
+                        Side possibleMoves[5] = {Side::NO_MOVE};
+                        unsigned int possible = 1;
+                        for(Side side : {Side::TO_UP, Side::TO_DOWN,
+                                         Side::TO_LEFT, Side::TO_RIGHT}) {
+                            if(map.getPathfinder().canMove(tile, side)) {
+                                possibleMoves[possible++] = side;
+                            }
+                        }
+                        return {possibleMoves[Utils::Misc::randUI(possible)],
+                                true};
+                    }
+                    case MoveStyle::FOLLOWING: {
+                        Side step = map.getPathfinder().nextStep(tile, player);
+                        if(step == Side::NO_MOVE) {
+                            break;
+                        }
+                        return {step, tile + offset(step) != player};
+                    }
+                }
+                return {};
+            }
+
+            void cancelStep(MoveStyle style, unsigned int &pathCounter,
+                            unsigned int pathLength) {
+                if(style == MoveStyle::PREDEFINED && pathLength != 0) {
+                    pathCounter = (pathCounter + pathLength - 1) % pathLength;
+                }
+            }
+
+        } // namespace Npc
+    } // namespace Elements
+} // namespace OpMon
@@ -0,0 +1,111 @@
+/*!
+ * \file NpcBehavior.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "src/opmon/model/Enums.hpp"
+
+namespace OpMon {
+    namespace Elements {
+
+        class Map;
+
+        /*!
+         * \brief Defines different ways of moving of the npcs.
+         * \ingroup Events
+         */
+        enum class MoveStyle : int {
+            NO_MOVE = 0,    /*!< The npc has to stay still.*/
+            PREDEFINED = 1, /*!< The npc follows a predefined path.*/
+            RANDOM = 2,     /*!< The npc moves randomly.*/
+            FOLLOWING = 3   /*!< The npc follows the player.*/
+        };
+
+        /*!
+         * \brief The movements and the animation of the npcs, shared by CharacterEvent and CharacterComponents.
+         * \details The texture of a npc has three rows of four frames, one frame per Side: the two steps of the walking animation, then the npc standing still.
+         */
+        namespace Npc {
+            /*!
+             * \brief The first frame of the first step of the walking animation.
+             */
+            constexpr int ANIM_1 = 0;
+            /*!
+             * \brief The first frame of the second step of the walking animation.
+             */
+            constexpr int ANIM_2 = 4;
+            /*!
+             * \brief The first frame of the npc standing still.
+             */
+            constexpr int STAND_STILL = 8;
+            /*!
+             * \brief The number of ticks of a step. The npcs move by 4 pixels each tick.
+             */
+            constexpr int STEP_TICKS = 8;
+
+            /*!
+             * \brief The next step of a npc, chosen by chooseStep().
+             */
+            struct Step {
+                /*!
+                 * \brief The direction of the step. Side::NO_MOVE waits for one step, Side::STAY does nothing.
+                 */
+                Side dir = Side::STAY;
+                /*!
+                 * \brief If `false`, the npc only turns to Step::dir.
+                 */
+                bool move = false;
+            };
+
+            /*!
+             * \returns The rectangle of a frame in the texture of a npc.
+             */
+            sf::IntRect frameRect(int frame);
+            /*!
+             * \returns The rectangle of the frame of a row facing a direction.
+             */
+            inline sf::IntRect frameRect(Side dir, int row) {
+                return frameRect((int)dir + row);
+            }
+
+            /*!
+             * \returns The movement of one tile in a direction, or (0, 0) if it isn't a direction.
+             */
+            sf::Vector2i offset(Side dir);
+            /*!
+             * \returns The opposite direction, used to face the player. Side::NO_MOVE if it isn't a direction.
+             */
+            Side opposite(Side dir);
+
+            /*!
+             * \brief Advances the walking animation by one tick.
+             * \param animTicks The counter of the animation of the npc.
+             * \returns The row of the frame to show, ANIM_1 or ANIM_2.
+             */
+            int walkRow(int &animTicks);
+
+            /*!
+             * \brief Chooses the next step of a npc which has finished its previous step.
+             * \details A npc following the player only turns to them when it is next to them.
+             * \param path The predefined path, used with MoveStyle::PREDEFINED.
+             * \param pathCounter The current step of the path, advanced to the chosen step.
+             */
+            Step chooseStep(MoveStyle style, sf::Vector2i tile,
+                            sf::Vector2i player, Map &map, Side const *path,
+                            unsigned int pathLength, unsigned int &pathCounter);
+
+            /*!
+             * \brief Goes back in the path after an impossible step, so that the step is tried again.
+             * \details Only changes the counter with MoveStyle::PREDEFINED.
+             */
+            void cancelStep(MoveStyle style, unsigned int &pathCounter,
+                            unsigned int pathLength);
+        } // namespace Npc
+
+    } // namespace Elements
+} // namespace OpMon
@@ -0,0 +1,253 @@
+/*
+Pathfinder.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "Pathfinder.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "Map.hpp"
+#include "Position.hpp"
+
+namespace OpMon {
+    namespace Elements {
+
+        namespace {
+            constexpr Side DIRECTIONS[] = {Side::TO_DOWN, Side::TO_RIGHT,
+                                           Side::TO_LEFT, Side::TO_UP};
+
+            Side opposite(Side dir) {
+                switch(dir) {
+                    case Side::TO_UP:
+                        return Side::TO_DOWN;
+                    case Side::TO_DOWN:
+                        return Side::TO_UP;
+                    case Side::TO_LEFT:
+                        return Side::TO_RIGHT;
+                    case Side::TO_RIGHT:
+                        return Side::TO_LEFT;
+                    default:
+                        return dir;
+                }
+            }
+        } // namespace
+
+        Pathfinder::Pathfinder(Map const &map)
+            : w(map.getW()), h(map.getH()), enterable(w * h, 0) {
+            sf::Vector2i pos;
+            for(pos.y = 0; pos.y < h; pos.y++) {
+                for(pos.x = 0; pos.x < w; pos.x++) {
+                    int layer1 =
+                        map.getTileCollision(map.getCurrentTileCode(pos, 1));
+                    int layer2 =
+                        map.getTileCollision(map.getCurrentTileCode(pos, 2));
+                    for(Side dir : DIRECTIONS) {
+                        if(Position::canEnter(layer1, dir) &&
+                           Position::canEnter(layer2, dir)) {
+                            enterable[cellOf(pos)] |= 1 << (int)dir;
+                        }
+                    }
+                }
+            }
+        }
+
+        void Pathfinder::newTick() {
+            tick++;
+            budget = NODES_PER_TICK;
+        }
+
+        int Pathfinder::neighbour(int cell, Side dir) const {
+            sf::Vector2i pos(cell % w, cell / w);
+            switch(dir) {
+                case Side::TO_UP:
+                    pos.y--;
+                    break;
+                case Side::TO_DOWN:
+                    pos.y++;
+                    break;
+                case Side::TO_LEFT:
+                    pos.x--;
+                    break;
+                case Side::TO_RIGHT:
+                    pos.x++;
+                    break;
+                default:
+                    break;
+            }
+            return inMap(pos) ? cellOf(pos) : -1;
+        }
+
+        bool Pathfinder::canMove(sf::Vector2i from, Side dir) const {
+            if(!inMap(from)) {
+                return false;
+            }
+            int next = neighbour(cellOf(from), dir);
+            return next != -1 && canEnter(next, dir);
+        }
+
+        Pathfinder::Target &Pathfinder::getTarget(int cell) {
+            for(Target &target : targets) {
+                if(target.cell == cell) {
+                    return target;
+                }
+            }
+            if(targets.size() >= MAX_TARGETS) {
+                auto oldest = std::min_element(
+                    targets.begin(), targets.end(),
+                    [](Target const &a, Target const &b) {
+                        return a.lastUsed < b.lastUsed;
+                    });
+                *oldest = Target();
+                oldest->cell = cell;
+                return *oldest;
+            }
+            targets.emplace_back();
+            targets.back().cell = cell;
+            return targets.back();
+        }
+
+        Side Pathfinder::nextStep(sf::Vector2i from, sf::Vector2i to) {
+            if(!inMap(from) || !inMap(to) || from == to) {
+                return Side::NO_MOVE;
+            }
+            int start = cellOf(from);
+            Target &target = getTarget(cellOf(to));
+            target.lastUsed = tick;
+
+            if(!target.field.empty()) {
+                continueField(target);
+                return target.field[start] == UNVISITED ?
+                           Side::NO_MOVE :
+                           (Side)target.field[start];
+            }
+            auto known = target.routes.find(start);
+            if(known != target.routes.end()) {
+                return known->second;
+            }
+
+            if(!search.running || search.from != start ||
+               search.target != target.cell) {
+                // Another npc is waiting for the current search
+                if(search.running && search.lastRequest + 1 >= tick) {
+                    return Side::NO_MOVE;
+                }
+                if(++target.searches >= CROWD_SEARCHES) {
+                    search.running = false;
+                    target.routes.clear();
+                    target.field.assign(w * h, UNVISITED);
+                    target.field[target.cell] = (int8_t)Side::NO_MOVE;
+                    target.frontier.push_back(target.cell);
+                    return nextStep(from, to);
+                }
+                startSearch(start, target.cell);
+            }
+            search.lastRequest = tick;
+            if(continueSearch(target)) {
+                return target.routes.at(start);
+            }
+            return Side::NO_MOVE;
+        }
+
+        void Pathfinder::startSearch(int from, int target) {
+            search.running = true;
+            search.from = from;
+            search.target = target;
+            if(search.costs.empty()) {
+                search.costs.resize(w * h);
+                search.cameFrom.resize(w * h);
+                search.visited.resize(w * h, 0);
+            }
+            if(++search.stamp == 0) {
+                std::fill(search.visited.begin(), search.visited.end(), 0);
+                search.stamp = 1;
+            }
+            search.open.clear();
+            search.open.push_back({0, 0, from});
+            search.costs[from] = 0;
+            search.visited[from] = search.stamp;
+        }
+
+        bool Pathfinder::continueSearch(Target &target) {
+            auto compare = [](Search::Node const &a, Search::Node const &b) {
+                // The tiles closer to the target first when the estimates
+                // are equal
+                return a.estimate > b.estimate ||
+                       (a.estimate == b.estimate && a.cost < b.cost);
+            };
+            int targetX = target.cell % w;
+            int targetY = target.cell / w;
+            while(!search.open.empty()) {
+                if(budget == 0) {
+                    return false;
+                }
+                budget--;
+                std::pop_heap(search.open.begin(), search.open.end(), compare);
+                Search::Node node = search.open.back();
+                search.open.pop_back();
+                if(node.cost > search.costs[node.cell]) {
+                    continue;
+                }
+                if(node.cell == target.cell) {
+                    // Keeps the next step of all the tiles of the path
+                    int cell = target.cell;
+                    while(cell != search.from) {
+                        Side dir = (Side)search.cameFrom[cell];
+                        cell = neighbour(cell, opposite(dir));
+                        target.routes[cell] = dir;
+                    }
+                    search.running = false;
+                    return true;
+                }
+                for(Side dir : DIRECTIONS) {
+                    int next = neighbour(node.cell, dir);
+                    if(next == -1 || !canEnter(next, dir)) {
+                        continue;
+                    }
+                    int cost = node.cost + 1;
+                    if(search.visited[next] == search.stamp &&
+                       search.costs[next] <= cost) {
+                        continue;
+                    }
+                    search.visited[next] = search.stamp;
+                    search.costs[next] = cost;
+                    search.cameFrom[next] = (int8_t)dir;
+                    int distance = std::abs(next % w - targetX) +
+                                   std::abs(next / w - targetY);
+                    search.open.push_back({cost + distance, cost, next});
+                    std::push_heap(search.open.begin(), search.open.end(),
+                                   compare);
+                }
+            }
+            // Unreachable
+            target.routes[search.from] = Side::NO_MOVE;
+            search.running = false;
+            return true;
+        }
+
+        void Pathfinder::continueField(Target &target) {
+            while(target.frontierStart < target.frontier.size() &&
+                  budget > 0) {
+                budget--;
+                int cell = target.frontier[target.frontierStart++];
+                for(Side dir : DIRECTIONS) {
+                    // The tile from which a movement in `dir` enters `cell`
+                    int previous = neighbour(cell, opposite(dir));
+                    if(previous == -1 || !canEnter(cell, dir) ||
+                       target.field[previous] != UNVISITED) {
+                        continue;
+                    }
+                    target.field[previous] = (int8_t)dir;
+                    target.frontier.push_back(previous);
+                }
+            }
+            if(target.frontierStart >= target.frontier.size() &&
+               !target.frontier.empty()) {
+                target.frontier = std::vector<int>();
+                target.frontierStart = 0;
+            }
+        }
+
+    } // namespace Elements
+} // namespace OpMon
@@ -0,0 +1,163 @@
+/*!
+ * \file Pathfinder.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "src/opmon/model/Enums.hpp"
+
+namespace OpMon {
+    namespace Elements {
+
+        class Map;
+
+        /*!
+         * \brief Finds the paths of the npcs in a map.
+         * \details The paths are searched on the collisions of the tiles of the map, computed once when the pathfinder is created. The events aren't taken into account: an npc blocked by an event waits for it to move.
+         *
+         * A path to a target is searched with A*, and all the steps of the path are kept for the target, so that following the path, or joining it, doesn't need another search. When several searches are needed for the same target, for example when a crowd of npcs follows the player, a flow field is computed instead: it gives the next step to the target from any tile of the map.
+         *
+         * The searches are spread over several ticks: each tick, at most Pathfinder::NODES_PER_TICK tiles are visited. An npc whose path isn't known yet waits, and asks again at the next tick. The number of targets kept is limited, the least recently used are forgotten.
+         */
+        class Pathfinder {
+          public:
+            /*!
+             * \brief The maximal number of tiles visited by the searches in one tick.
+             */
+            static constexpr unsigned int NODES_PER_TICK = 1024;
+            /*!
+             * \brief The maximal number of targets whose paths are kept.
+             */
+            static constexpr unsigned int MAX_TARGETS = 8;
+            /*!
+             * \brief The number of A* searches for a target after which a flow field is computed for it.
+             */
+            static constexpr unsigned int CROWD_SEARCHES = 2;
+
+            /*!
+             * \brief Computes the collisions of a loaded map.
+             */
+            explicit Pathfinder(Map const &map);
+
+            /*!
+             * \brief Starts a new tick, giving back the search budget. Called once per frame, before updating the events.
+             */
+            void newTick();
+
+            /*!
+             * \brief Checks if the tiles allow a movement, without looking at the events.
+             */
+            bool canMove(sf::Vector2i from, Side dir) const;
+
+            /*!
+             * \brief Gives the next movement to go from a position to a target.
+             * \returns The direction of the next step, or Side::NO_MOVE if the target is reached, unreachable, or if the path isn't known yet.
+             */
+            Side nextStep(sf::Vector2i from, sf::Vector2i target);
+
+          private:
+            /*!
+             * \brief The paths known for a target.
+             */
+            struct Target {
+                int cell;
+                /*!
+                 * \brief The tick of the last request for this target.
+                 */
+                unsigned int lastUsed = 0;
+                unsigned int searches = 0;
+                /*!
+                 * \brief The next step from the tiles of the paths found by A*, by tile.
+                 */
+                std::unordered_map<int, Side> routes;
+                /*!
+                 * \brief The next step from each tile of the map, empty until a flow field is needed.
+                 * \details Built by a breadth-first search from the target, which may not be finished yet: the unvisited tiles hold Pathfinder::UNVISITED.
+                 */
+                std::vector<int8_t> field;
+                /*!
+                 * \brief The tiles of the flow field still to visit, from `frontierStart`.
+                 */
+                std::vector<int> frontier;
+                unsigned int frontierStart = 0;
+            };
+
+            /*!
+             * \brief The A* search in progress. Only one search runs at a time.
+             */
+            struct Search {
+                bool running = false;
+                int from = -1;
+                int target = -1;
+                unsigned int lastRequest = 0;
+                /*!
+                 * \brief The tiles to visit, as a heap on the estimated cost.
+                 */
+                struct Node {
+                    int estimate;
+                    int cost;
+                    int cell;
+                };
+                std::vector<Node> open;
+                std::vector<int> costs;
+                std::vector<int8_t> cameFrom;
+                /*!
+                 * \brief The search in which each tile has been visited, to avoid clearing the arrays.
+                 */
+                std::vector<unsigned int> visited;
+                unsigned int stamp = 0;
+            };
+
+            static constexpr int8_t UNVISITED = INT8_MIN;
+
+            int cellOf(sf::Vector2i position) const {
+                return position.x + position.y * w;
+            }
+            bool inMap(sf::Vector2i position) const {
+                return position.x >= 0 && position.y >= 0 && position.x < w &&
+                       position.y < h;
+            }
+            /*!
+             * \returns The neighbour of a tile in a direction, or -1 if it is out of the map.
+             */
+            int neighbour(int cell, Side dir) const;
+            /*!
+             * \returns `true` if the tile can be entered with a movement in this direction.
+             */
+            bool canEnter(int cell, Side dir) const {
+                return (enterable[cell] >> (int)dir) & 1;
+            }
+
+            Target &getTarget(int cell);
+            void startSearch(int from, int target);
+            /*!
+             * \brief Continues the A* search within the budget of the tick.
+             * \returns `true` if the search has ended, in which case the path has been added to `target`.
+             */
+            bool continueSearch(Target &target);
+            /*!
+             * \brief Continues the computation of the flow field of a target within the budget of the tick.
+             */
+            void continueField(Target &target);
+
+            int w;
+            int h;
+            /*!
+             * \brief For each tile, the directions in which it can be entered, one bit per direction.
+             */
+            std::vector<uint8_t> enterable;
+
+            unsigned int tick = 1;
+            unsigned int budget = NODES_PER_TICK;
+            std::vector<Target> targets;
+            Search search;
+        };
+
+    } // namespace Elements
+} // namespace OpMon
@@ -91,29 +91,39 @@ namespace OpMon {
             }
         }
 
+        bool Position::canEnter(int collision, Side dir) {
+            switch(dir) {
+                case Side::TO_UP:
+                    return collision == 0 || collision == 8;
+                case Side::TO_DOWN:
+                    return collision == 0 || collision == 7;
+                case Side::TO_LEFT:
+                    return collision == 0 || collision == 6;
+                case Side::TO_RIGHT:
+                    return collision == 0 || collision == 5;
+                default:
+                    return true;
+            }
+        }
+
         bool Position::checkPass(Side direction, Map *map) {
             std::list<AbstractEvent *> nextEvents;
             sf::Vector2i nextPos;
             sf::Vector2i nextPosPix;
-            int exclusiveCol = 0;
 
             // Finds the next tile's position
             switch(direction) {
                 case Side::TO_UP:
                     nextPos = sf::Vector2i(posX, posY - 1);
-                    exclusiveCol = 8;
                     break;
                 case Side::TO_DOWN:
                     nextPos = sf::Vector2i(posX, posY + 1);
-                    exclusiveCol = 7;
                     break;
                 case Side::TO_LEFT:
                     nextPos = sf::Vector2i(posX - 1, posY);
-                    exclusiveCol = 6;
                     break;
                 case Side::TO_RIGHT:
                     nextPos = sf::Vector2i(posX + 1, posY);
-                    exclusiveCol = 5;
                     break;
                 default:
                     return true;
@@ -129,10 +139,10 @@ namespace OpMon {
                     map->getTileCollision(map->getCurrentTileCode(nextPos, 1));
                 int colLayer2 =
                     map->getTileCollision(map->getCurrentTileCode(nextPos, 2));
-                if((colLayer1 == 0 || colLayer1 == exclusiveCol) &&
-                   (colLayer2 == 0 ||
-                    colLayer2 ==
-                        exclusiveCol)) { // Checks if the next tile is passable
+                if(canEnter(colLayer1, direction) &&
+                   canEnter(colLayer2, direction) &&
+                   !map->getCharacters().isBlocking(
+                       nextPos)) { // Checks if the next tile is passable
                     if(!(nextPos.y == playerPos->getPosition().y &&
                          nextPos.x ==
                              playerPos->getPosition()
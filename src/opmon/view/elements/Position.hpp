@@ -111,6 +111,14 @@ namespace OpMon {
              */
             bool move(Side dir, Map *map, bool noclip = false);
 
+            /*!
+             * \brief Checks if a tile can be entered with a movement, according to its collision.
+             * \details The tiles with a collision 5 to 8 can only be entered from one side.
+             * \param collision The collision of the tile on one layer.
+             * \param dir The direction of the movement entering the tile.
+             */
+            static bool canEnter(int collision, Side dir);
+
             /*!
              * \brief Sets the position of Position::playerPos
              */
@@ -6,12 +6,12 @@
 
 namespace OpMon {
     namespace Elements {
-        AbstractEvent::AbstractEvent(sf::Texture &texture,
+        AbstractEvent::AbstractEvent(sf::Texture const &texture,
                                      std::vector<sf::IntRect> rectangles,
                                      EventTrigger eventTrigger,
                                      sf::Vector2f const &position, int sides,
                                      bool passable)
-            : texture(texture),
+            : texture(&texture),
               rectangles(rectangles),
               eventTrigger(eventTrigger),
               position(32.0f * position),
@@ -23,7 +23,7 @@ namespace OpMon {
 
         AbstractEvent::AbstractEvent(OverworldData &data,
                                      nlohmann::json jsonData)
-            : texture(data.getEventsTexture(jsonData.at("textures"))),
+            : texture(&data.getEventsTexture(jsonData.at("textures"))),
               rectangles({sf::IntRect()}),
               eventTrigger(jsonData.value("trigger", EventTrigger::PRESS)),
               position(
@@ -34,8 +34,11 @@ namespace OpMon {
               mapPos((1.0f / 32.0f) * position),
               passable(jsonData.value("passable", true)),
               sides(jsonData.value("side", SIDE_ALL)),
-              sprite(new sf::Sprite(texture)),
-              currentFrame(rectangles.begin()) {}
+              sprite(new sf::Sprite()),
+              currentFrame(rectangles.begin()) {
+            // The sprite is initialized before the texture
+            sprite->setTexture(*texture, true);
+        }
 
         void AbstractEvent::updateFrame() {
             this->sprite->setPosition(position);
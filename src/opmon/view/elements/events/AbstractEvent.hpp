@@ -9,6 +9,7 @@
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <cstdint>
 #include <memory>
 
 #include "src/nlohmann/json.hpp"
@@ -90,8 +91,9 @@ namespace OpMon {
 
             /*!
              * \brief The texture used by the event.
+             * \details The texture is owned by OverworldData and shared by all the events using it, so it is never copied.
              */
-            sf::Texture texture;
+            sf::Texture const *texture;
 
             /*!
              * \brief The list of rectangles used to animate the event if need.
@@ -109,7 +111,7 @@ namespace OpMon {
             /*!
              * \warning The parameter position represents the position in squares, unlike the field position which stores the position in pixels.
              */
-            AbstractEvent(sf::Texture &texture,
+            AbstractEvent(sf::Texture const &texture,
                           std::vector<sf::IntRect> rectangles,
                           EventTrigger eventTrigger,
                           sf::Vector2f const &position, int sides,
@@ -129,6 +131,16 @@ namespace OpMon {
              */
             virtual void updateFrame();
 
+            /*!
+             * \brief Returns the state of the event kept in the save files (see SaveGame).
+             * \details Events which can change during the game, like the trainers, override this method and setSaveState(). 0 is the state of an event which hasn't changed.
+             */
+            virtual std::uint8_t getSaveState() const { return 0; }
+            /*!
+             * \brief Restores a state returned by getSaveState().
+             */
+            virtual void setSaveState(std::uint8_t state) { (void)state; }
+
             int getSide() const { return sides; }
             virtual const sf::IntRect &getFrameRect() { return *currentFrame; }
             EventTrigger getEventTrigger() const { return eventTrigger; }
@@ -18,7 +18,8 @@ namespace OpMon {
             : AbstractEvent(data, jsonData),
               team(data.getTrainer(jsonData.at("trainer"))) {
             this->rectangles = std::vector<sf::IntRect> {
-                sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y)};
+                sf::IntRect(0, 0, texture->getSize().x,
+                            texture->getSize().y)};
             this->currentFrame = rectangles.begin();
         }
 
@@ -29,7 +30,13 @@ namespace OpMon {
             }
         }
 
-        void BattleEvent::update(Overworld &overworld) {}
+        void BattleEvent::update(Overworld &overworld) {
+            if(over) {
+                overworld.getData().getBattleData().warmUpNear(
+                    mapPos.getPosition(),
+                    overworld.getCharacter().getPositionMap().getPosition());
+            }
+        }
 
         BattleEvent::~BattleEvent() { delete(team); }
 
@@ -1,11 +1,6 @@
 #include "CharacterEvent.hpp"
 
 #include "src/opmon/screens/overworld/Overworld.hpp"
-#include "src/utils/misc.hpp"
-
-#define ANIM_1 0
-#define ANIM_2 4
-#define STAND_STILL 8
 
 namespace OpMon {
     namespace Elements {
@@ -55,8 +50,7 @@ namespace OpMon {
             // Initialization of rectangles
             rectangles.clear();
             for(unsigned int i = 0; i < 12; i++) {
-                rectangles.push_back(
-                    sf::IntRect((i * 32) % 128, (i / 4) * 32, 32, 32));
+                rectangles.push_back(Npc::frameRect(i));
             }
             currentFrame = rectangles.begin();
         }
@@ -64,156 +58,50 @@ namespace OpMon {
         void CharacterEvent::update(Overworld &overworld) {
             frames++;
             if(!mapPos.isAnim()) { // Checks if not already moving
-                int randomMove;
-                switch(moveStyle) {
-                    case MoveStyle::PREDEFINED: // Movement predefined during
-                                                // the npc's initialization
-                        predefinedCounter++;
-                        if(predefinedCounter >=
-                           movements.size()) { // TODO : Add the possibility of
-                                               // disabling the loop, for
-                                               // one-time movements
-                            predefinedCounter = 0;
-                        }
-
-                        if(!move(
-                               movements[predefinedCounter],
-                               overworld.getData()
-                                   .getCurrentMap())) { // If the movement is
-                                                        // impossible, decreases
-                                                        // the counter to not
-                                                        // ignore the movement.
-                            if(predefinedCounter != 0) {
-                                predefinedCounter--;
-                            } else {
-                                predefinedCounter = movements.size() - 1;
-                            }
-                        }
-                        break;
-
-                    case MoveStyle::NO_MOVE: // This is easy to do.
-                        break;
-
-                    case MoveStyle::RANDOM: // I don't think I will be using
-                                            // this often, but I keep it here,
-                                            // who knows?
-                        randomMove = Utils::Misc::randUI(5) - 1;
-                        try {
-                            switch(randomMove) {
-                                case -1:
-                                    move(Side::NO_MOVE,
-                                         overworld.getData().getCurrentMap());
-                                    break;
-                                case 0:
-                                    move(Side::TO_UP,
-                                         overworld.getData().getCurrentMap());
-                                    break;
-                                case 1:
-                                    move(Side::TO_DOWN,
-                                         overworld.getData().getCurrentMap());
-                                    break;
-                                case 2:
-                                    move(Side::TO_LEFT,
-                                         overworld.getData().getCurrentMap());
-                                    break;
-                                case 3:
-                                    move(Side::TO_RIGHT,
-                                         overworld.getData().getCurrentMap());
-                                    break;
-                                default:
-                                    throw Utils::UnexpectedValueException(
-                                        std::to_string(randomMove),
-                                        "an integer in [-1,3] representing a "
-                                        "random movement in "
-                                        "CharacterEvent::update");
-                            }
-                        } catch(Utils::UnexpectedValueException &e) {
-                            if(e.fatal)
-                                throw;
-                            Utils::Log::oplog(e.desc(), true);
-                            move(Side::NO_MOVE,
-                                 overworld.getData().getCurrentMap());
-                        }
-                        break;
-
-                    case MoveStyle::FOLLOWING:
-                        // TODO
-                        break;
+                Map *map = overworld.getData().getCurrentMap();
+                sf::Vector2i player =
+                    overworld.getCharacter().getPositionMap().getPosition();
+                Npc::Step step = Npc::chooseStep(
+                    moveStyle, mapPos.getPosition(), player, *map,
+                    movements.data(), movements.size(), predefinedCounter);
+                if(!step.move) {
+                    if(step.dir != Side::STAY) {
+                        mapPos.setDir(step.dir);
+                    }
+                } else if(!move(step.dir, map)) {
+                    Npc::cancelStep(moveStyle, predefinedCounter,
+                                    movements.size());
                 }
             }
             // Changes the texture to print, handles the movement itself.
-            if(mapPos.isAnim() && !anims &&
-               mapPos.getDir() != Side::STAY) { // First part of the animation
-                currentFrame =
-                    rectangles.begin() + ((int)mapPos.getDir() + ANIM_1);
-                animsCounter++;
-                anims = animsCounter > 8;
-            } else if(mapPos.isAnim() && anims &&
-                      mapPos.getDir() !=
-                          Side::STAY) { // Second part of the animation
+            if(mapPos.isAnim() && mapPos.getDir() != Side::STAY) {
                 currentFrame =
-                    rectangles.begin() + ((int)mapPos.getDir() + ANIM_2);
-                animsCounter++;
-                if(animsCounter > 16) {
-                    anims = false;
-                    animsCounter = 0;
-                }
+                    rectangles.begin() +
+                    ((int)mapPos.getDir() + Npc::walkRow(animsCounter));
             } else if(!mapPos.isAnim()) { // The NPC is resting. With all these
                                           // movements, maybe they're tired.
-                currentFrame =
-                    rectangles.begin() + ((int)mapPos.getDir() + STAND_STILL);
+                currentFrame = rectangles.begin() +
+                               ((int)mapPos.getDir() + Npc::STAND_STILL);
             }
 
             // This part moves the sprite's position
             if(mapPos.isAnim()) {
-                sf::Vector2f toMove;
-                switch(mapPos.getDir()) {
-                    case Side::TO_UP:
-                        toMove = sf::Vector2f(0, -4);
-                        break;
-
-                    case Side::TO_DOWN:
-                        toMove = sf::Vector2f(0, 4);
-                        break;
-
-                    case Side::TO_LEFT:
-                        toMove = sf::Vector2f(-4, 0);
-                        break;
-
-                    case Side::TO_RIGHT:
-                        toMove = sf::Vector2f(4, 0);
-                        break;
-                    default:
-                        break;
-                }
                 if(mapPos.isMoving())
-                    position += toMove;
-                if(frames - startFrames >= 8)
+                    position +=
+                        4.0f * sf::Vector2f(Npc::offset(mapPos.getDir()));
+                if(frames - startFrames >= Npc::STEP_TICKS)
                     mapPos.stopMove();
             }
             if(wantmove && !mapPos.isAnim()) {
-                switch(overworld.getCharacter()
-                           .getPositionMap()
-                           .getDir()) { // Put the character's face in front of
-                                        // the player's one
-                    case Side::TO_DOWN:
-                        mapPos.setDir(Side::TO_UP);
-                        break;
-                    case Side::TO_UP:
-                        mapPos.setDir(Side::TO_DOWN);
-                        break;
-                    case Side::TO_LEFT:
-                        mapPos.setDir(Side::TO_RIGHT);
-                        break;
-                    case Side::TO_RIGHT:
-                        mapPos.setDir(Side::TO_LEFT);
-                        break;
-                    default:
-                        break;
+                // Put the character's face in front of the player's one
+                Side toPlayer = Npc::opposite(
+                    overworld.getCharacter().getPositionMap().getDir());
+                if(toPlayer != Side::NO_MOVE) {
+                    mapPos.setDir(toPlayer);
                 }
                 // Put the correct texture to the NPC
-                currentFrame =
-                    rectangles.begin() + ((int)mapPos.getDir() + STAND_STILL);
+                currentFrame = rectangles.begin() +
+                               ((int)mapPos.getDir() + Npc::STAND_STILL);
                 updateFrame();
                 wantmove = false;
             }
@@ -6,26 +6,18 @@
 
 #pragma once
 
+#include "../NpcBehavior.hpp"
 #include "AbstractEvent.hpp"
 
 namespace OpMon::Elements {
 
-    /*!
-     * \brief Defines different ways of moving of the npcs.
-     * \ingroup Events
-     */
-    enum class MoveStyle : int {
-        NO_MOVE = 0,    /*!< The npc has to stay still.*/
-        PREDEFINED = 1, /*!< The npc follows a predefined path.*/
-        RANDOM = 2,     /*!< The npc moves randomly.*/
-        FOLLOWING = 3   /*!< The npc follows the player (unimplemented yet).*/
-    };
-
     /*!
      * \brief A NPC that just walks through the map.
      * \ingroup Events
      *
      * When the NPC is triggered, it turns itself to face the player.
+     * The paths of the NPCs following the player are given by the Pathfinder of the map.
+     * The "Character" events of the map files are stored in CharacterComponents instead, this class is used by the scripted events built on a NPC. Both move and animate the npcs with the functions of Npc.
      */
     class CharacterEvent : public AbstractEvent {
       protected:
@@ -39,7 +31,7 @@ namespace OpMon::Elements {
          */
         unsigned int predefinedCounter = 0;
         /*!
-         * \brief A counter for the movement animation.
+         * \brief A counter for the movement animation, see Npc::walkRow().
          */
         int animsCounter = 0;
 
@@ -52,10 +44,6 @@ namespace OpMon::Elements {
          * \brief The frame number when the movement animation started.
          */
         int startFrames = 0;
-        /*!
-         * \brief If the npc is currently animated.
-         */
-        bool anims = false;
         /*!
          * \brief Counts the frames.
          */
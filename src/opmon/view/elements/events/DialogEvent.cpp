@@ -12,37 +12,29 @@ namespace OpMon {
                                  EventTrigger eventTrigger, bool passable)
             : AbstractEvent(texture, rectangles, eventTrigger, position, sides,
                             passable),
-              Utils::I18n::ATranslatable(),
-              dialogKey(dialogKey) {
-            this->onLangChanged();
-        }
+              dialogKey(dialogKey) {}
 
         DialogEvent::DialogEvent(OverworldData &data, nlohmann::json jsonData)
-            : AbstractEvent(data, jsonData), Utils::I18n::ATranslatable() {
+            : AbstractEvent(data, jsonData) {
             Utils::OpString dialog;
             std::vector<std::string> dialogKeys =
                 jsonData.value("dialog", std::vector<std::string>());
             std::string key = dialogKeys[0];
-            std::vector<sf::String *> toAdd;
+            std::vector<const sf::String *> toAdd;
             for(unsigned int j = 1; j < dialogKeys.size(); j++) {
                 toAdd.push_back(data.getCompletion(dialogKeys[j]));
             }
             this->dialogKey = Utils::OpString(
                 data.getGameDataPtr()->getStringKeys(), key, toAdd);
-            this->onLangChanged();
 
             this->rectangles = std::vector<sf::IntRect> {
-                sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y)};
+                sf::IntRect(0, 0, texture->getSize().x,
+                            texture->getSize().y)};
             this->currentFrame = rectangles.begin();
         }
 
-        void DialogEvent::onLangChanged() {
-            dialog.clear();
-            dialog = dialogKey.getString(stringkeys);
-        }
-
         void DialogEvent::action(Overworld &overworld) {
-            overworld.startDialog(this->dialog);
+            overworld.startDialog(dialogKey);
             over = overworld.isDialogOver();
         }
 
@@ -52,7 +44,6 @@ namespace OpMon {
 
         void DialogEvent::changeDialog(Utils::OpString newDialog) {
             dialogKey = newDialog;
-            this->onLangChanged();
         }
 
     } /* namespace Elements */
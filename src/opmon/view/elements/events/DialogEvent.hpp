@@ -7,7 +7,7 @@
 #pragma once
 
 #include "AbstractEvent.hpp"
-#include "src/utils/i18n/ATranslatable.hpp"
+#include "src/utils/OpString.hpp"
 
 namespace OpMon {
     namespace Elements {
@@ -15,18 +15,13 @@ namespace OpMon {
          * \brief An event that shows a dialog.
          * \ingroup Events
          */
-        class DialogEvent :
-            public AbstractEvent,
-            public Utils::I18n::ATranslatable {
+        class DialogEvent : public AbstractEvent {
           private:
             /*!
              * \brief The OpString containing the dialog to show.
+             * \details Completed and wrapped by Ui::Dialog, which caches the lines for the current language.
              */
             Utils::OpString dialogKey;
-            /*!
-             * \brief The dialog to show.
-             */
-            sf::String dialog;
 
             /*!
              * \brief If the dialog is over.
@@ -41,7 +36,6 @@ namespace OpMon {
                         EventTrigger eventTrigger = EventTrigger::PRESS,
                         bool passable = false);
             DialogEvent(OverworldData &data, nlohmann::json jsonData);
-            void onLangChanged() override;
             virtual void update(Overworld &overworld);
             virtual void action(Overworld &overworld);
             /*!
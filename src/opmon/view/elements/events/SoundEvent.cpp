@@ -13,17 +13,23 @@ namespace OpMon {
                                bool toggle, int sides, bool passable)
             : AbstractEvent(texture, rectangles, eventTrigger, position, sides,
                             passable),
-              playID(playID),
+              musicId(music ? MusicId::find(playID) : MusicId()),
+              soundId(music ? SoundId() : SoundId::find(playID)),
               music(music),
               toggle(toggle) {}
 
         SoundEvent::SoundEvent(OverworldData &data, nlohmann::json jsonData)
             : AbstractEvent(data, jsonData),
-              playID(jsonData.at("playID")),
               music(jsonData.value("music", false)),
               toggle(jsonData.value("toggle", false)) {
+            if(music) {
+                musicId = MusicId::find(jsonData.at("playID"));
+            } else {
+                soundId = SoundId::find(jsonData.at("playID"));
+            }
             this->rectangles = std::vector<sf::IntRect> {
-                sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y)};
+                sf::IntRect(0, 0, texture->getSize().x,
+                            texture->getSize().y)};
             this->currentFrame = rectangles.begin();
         }
 
@@ -34,10 +40,10 @@ namespace OpMon {
                 jukebox.stop();
                 playing = false;
             } else if(music) {
-                jukebox.play(playID);
+                jukebox.play(musicId);
                 playing = true;
             } else {
-                jukebox.playSound(playID);
+                jukebox.playSound(soundId);
             }
         }
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "AbstractEvent.hpp"
+#include "src/opmon/core/Ids.hpp"
 
 namespace OpMon::Elements {
     /*!
@@ -16,9 +17,13 @@ namespace OpMon::Elements {
     class SoundEvent : public AbstractEvent {
       private:
         /*!
-         * \brief The ID of the sound/music to play.
+         * \brief The ID of the music to play, if the thing to play is a music.
          */
-        std::string playID;
+        MusicId musicId;
+        /*!
+         * \brief The ID of the sound to play, if the thing to play is a sound.
+         */
+        SoundId soundId;
 
         /*!
          * \brief If the thing to play is a music.
@@ -9,7 +9,7 @@ namespace OpMon {
                          std::vector<sf::IntRect> rectangles,
                          EventTrigger eventTrigger,
                          sf::Vector2f const &position,
-                         sf::Vector2i const &tpPos, std::string const &map,
+                         sf::Vector2i const &tpPos, MapId map,
                          Side ppDir, int sides, bool passable)
             : AbstractEvent(texture, rectangles, eventTrigger, position, sides,
                             passable),
@@ -21,10 +21,11 @@ namespace OpMon {
             : AbstractEvent(data, jsonData),
               tpCoord(sf::Vector2f(jsonData.at("tp").at("position")[0],
                                    jsonData.at("tp").at("position")[1])),
-              map(jsonData.at("tp").at("map")),
+              map(MapId::find(jsonData.at("tp").at("map"))),
               ppDir(jsonData.at("tp").value("side", Side::NO_MOVE)) {
             this->rectangles = std::vector<sf::IntRect> {
-                sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y)};
+                sf::IntRect(0, 0, texture->getSize().x,
+                            texture->getSize().y)};
             this->currentFrame = rectangles.begin();
         }
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "AbstractEvent.hpp"
+#include "src/opmon/core/Ids.hpp"
 
 namespace OpMon {
     namespace Elements {
@@ -26,7 +27,7 @@ namespace OpMon {
             /*!
              * \brief The id of he map where the event will teleport the player.
              */
-            std::string map;
+            MapId map;
             /*!
              * \brief The direction in which the character will be looking after the teleportation.
              */
@@ -39,7 +40,7 @@ namespace OpMon {
           public:
             TPEvent(sf::Texture &texture, std::vector<sf::IntRect> rectangles,
                     EventTrigger eventTrigger, sf::Vector2f const &position,
-                    sf::Vector2i const &tpCoord, std::string const &map,
+                    sf::Vector2i const &tpCoord, MapId map,
                     Side ppDir = Side::NO_MOVE, int sides = SIDE_ALL,
                     bool passable = true);
             TPEvent(OverworldData &data, nlohmann::json jsonData);
@@ -74,6 +74,11 @@ namespace OpMon::Elements {
     }
 
     void TrainerEvent::update(Overworld &overworld) {
+        if(!defeated) {
+            overworld.getData().getBattleData().warmUpNear(
+                eventQueue.front()->getPositionMapRef().getPosition(),
+                overworld.getCharacter().getPositionMap().getPosition());
+        }
         eventQueue.front()->update(
             overworld); // Updates the first event in the queue.
         if(triggered && !defeated &&
@@ -106,6 +111,24 @@ namespace OpMon::Elements {
         AbstractMetaEvent::update(overworld);
     }
 
+    void TrainerEvent::setSaveState(std::uint8_t state) {
+        if(state != 1 || defeated) {
+            return;
+        }
+        // Same as the end of a battle in update(), without the battle
+        garbage.push_back(eventQueue.front());
+        eventQueue.pop();
+        garbage.push_back(eventQueue.front());
+        eventQueue.pop();
+        defeated = true;
+        triggered = false;
+        if(eventQueue.front()->getPositionMap().getPosition() ==
+           sf::Vector2i(0, 0))
+            eventQueue.front()->setPosition(
+                garbage.front()->getPositionMap().getPosition());
+        mainEvent = eventQueue.front();
+    }
+
     void TrainerEvent::action(Overworld &overworld) {
         eventQueue.front()->action(
             overworld); // Triggers the first event in the queue.
@@ -72,5 +72,13 @@ namespace OpMon::Elements {
         void action(Overworld &overworld);
         void update(Overworld &overworld);
         bool isDefeated() { return defeated; }
+        /*!
+         * \brief Returns 1 if the trainer has been defeated, 0 otherwise.
+         */
+        std::uint8_t getSaveState() const override { return defeated; }
+        /*!
+         * \brief Sets the trainer as defeated if `state` is 1, without launching the battle.
+         */
+        void setSaveState(std::uint8_t state) override;
     };
 } // namespace OpMon::Elements
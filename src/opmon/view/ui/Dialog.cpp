@@ -6,7 +6,11 @@ File under GNU GPL v3.0 license
 */
 #include "Dialog.hpp"
 
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include "../../../utils/Profiler.hpp"
 #include "../../../utils/StringKeys.hpp"
+#include "../../../utils/TextLayout.hpp"
 #include "../../../utils/defines.hpp"
 #include "TextBox.hpp"
 #include "Window.hpp"
@@ -27,6 +31,8 @@ namespace OpMon {
             dialogBox = new TextBox(gamedata->getMenuFrame(), dialogBoxPosition,
                                     DIALOG_BOX_WIDTH, DIALOG_BOX_HEIGHT, 3);
             dialogBox->setFont(gamedata->getFont());
+            // Same position as the left text of the box
+            textPosition = dialogBoxPosition + sf::Vector2f(24, 24);
 
             // Create the arrow that appears to prompt the player to press the
             // action key
@@ -35,6 +41,22 @@ namespace OpMon {
             arrDialY = dialogBoxY + DIALOG_BOX_HEIGHT - 32;
             arrDial.setPosition(arrDialX, arrDialY);
             arrDial.setScale(2, 2);
+
+            layoutPage();
+        }
+
+        void Dialog::layoutPage() {
+            Utils::TextLayout &layout =
+                Utils::TextLayout::get(gamedata->getFont(), 16);
+            pageVertices.clear();
+            glyphEnds.clear();
+            i = 0;
+            for(unsigned int line = 0; line < 2 && !text.empty(); line++) {
+                layout.appendGlyphs(text.front(),
+                                    textPosition + sf::Vector2f(0, 24 * line),
+                                    sf::Color::Black, pageVertices, &glyphEnds);
+                text.pop();
+            }
         }
 
         Dialog::Dialog(std::queue<sf::String> text, GameData *gamedata)
@@ -64,23 +86,28 @@ namespace OpMon {
             init();
         }
 
+        Dialog::Dialog(Utils::OpString const &text, GameData *gamedata)
+            : gamedata(gamedata) {
+            for(sf::String const &line :
+                Utils::TextLayout::get(gamedata->getFont(), 16)
+                    .wrap(gamedata->getStringKeys(), text, 456)) {
+                this->text.push(line);
+            }
+
+            init();
+        }
+
         void Dialog::pass() {
             if(changeDialog == false) {
                 // If the current lines are not completely displayed, display
                 // them in full when pressing space
-                for(uint32_t p = line; p < 2; p++) {
-                    currentTxt[p] = text.front();
-                    text.pop();
-                }
+                i = glyphEnds.size();
                 changeDialog = true;
             } else if(text.size() > 0) {
                 // If the current lines are completely displayed, pass to the
                 // next set of lines when pressing space (if there is one)
                 gamedata->getJukebox().playSound("dialog pass");
-                line = 0;
-                i = 0;
-                currentTxt[0] = sf::String(" ");
-                currentTxt[1] = sf::String(" ");
+                layoutPage();
                 changeDialog = false;
             } else {
                 // If there are no more lines to display
@@ -89,27 +116,14 @@ namespace OpMon {
         }
 
         void Dialog::updateTextAnimation() {
+            OPMON_PROFILE_ZONE("Dialog::updateTextAnimation");
             if(!changeDialog) {
-                if(i < text.front().toUtf32().size()) {
-                    if(currentTxt[line] == sf::String(" ")) {
-                        currentTxt[line] = text.front().toUtf32()[i];
-                    } else if(text.front().toUtf32()[i] > 10) {
-                        currentTxt[line] += text.front().toUtf32()[i];
-                    }
+                if(i < glyphEnds.size()) {
                     i++;
                 } else {
-                    text.pop();
-                    line++;
-                    if(line == 2) {
-                        changeDialog = true;
-                    } else {
-                        i = 0;
-                    }
+                    changeDialog = true;
                 }
             }
-            for(size_t itor = 0; itor < 2; itor++) {
-                dialogBox->setLeftContent(currentTxt[itor].toUtf32(), itor);
-            }
             sf::Vector2f posArrow(arrDialX, arrDialY);
             arrDial.move(0, 0.33f);
             if(arrDial.getPosition().y - posArrow.y > 5) {
@@ -119,7 +133,17 @@ namespace OpMon {
 
         void Dialog::draw(sf::RenderTarget &target,
                           sf::RenderStates states) const {
+            OPMON_PROFILE_ZONE("Dialog::draw");
             target.draw(*dialogBox);
+            if(i > 0 && glyphEnds[i - 1] > 0) {
+                // The texture is asked at each draw because the font can
+                // replace it when it loads new glyphs.
+                states.texture =
+                    &Utils::TextLayout::get(gamedata->getFont(), 16)
+                         .getTexture();
+                target.draw(pageVertices.data(), glyphEnds[i - 1], sf::Quads,
+                            states);
+            }
             {
                 if(text.size() > 0 && changeDialog)
                     target.draw(arrDial);
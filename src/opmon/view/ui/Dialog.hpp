@@ -7,9 +7,12 @@
 
 #pragma once
 
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System.hpp>
 #include <queue>
+#include <vector>
 
+#include "../../../utils/OpString.hpp"
 #include "../../core/GameData.hpp"
 #include "../ui/TextBox.hpp"
 
@@ -32,9 +35,20 @@ namespace OpMon {
             std::queue<sf::String> text;
 
             /*!
-             * \brief The 3 lines currently displayed.
+             * \brief The glyphs of the 2 lines currently displayed.
+             * \details Built once per page by Dialog::layoutPage.
              */
-            sf::String currentTxt[2] = {sf::String(" "), sf::String(" ")};
+            std::vector<sf::Vertex> pageVertices;
+
+            /*!
+             * \brief For each character of the page, the number of vertices to draw to display the text up to this character.
+             */
+            std::vector<std::size_t> glyphEnds;
+
+            /*!
+             * \brief The position of the first line of text.
+             */
+            sf::Vector2f textPosition;
 
             /*!
              * \brief Checks if the dialog box is full.
@@ -44,14 +58,9 @@ namespace OpMon {
             bool changeDialog = false;
 
             /*!
-             * \brief Number of completely displayed lines.
+             * \brief Number of characters of the page displayed by the text animation.
              */
-            uint32_t line = 0;
-
-            /*!
-             * \brief Index of the next character to display by the text animation.
-             */
-            uint32_t i = 0;
+            std::size_t i = 0;
 
             /*!
              * \brief Set to `true` when the entire dialog has been displayed.
@@ -72,6 +81,11 @@ namespace OpMon {
 
             void init();
 
+            /*!
+             * \brief Takes the next 2 lines of the dialog and lays out their glyphs.
+             */
+            void layoutPage();
+
           public:
             /*!
              * \brief Initises a dialog with a queue of texts to print.
@@ -83,6 +97,12 @@ namespace OpMon {
              * \param text The text of the dialog.
              */
             Dialog(sf::String text, GameData *gamedata);
+            /*!
+             * \brief Initialises a dialog with a string of StringKeys.
+             * \details The lines are cached by Utils::TextLayout, so the string isn't wrapped again each time the dialog is opened.
+             * \param text The text of the dialog.
+             */
+            Dialog(Utils::OpString const &text, GameData *gamedata);
 
             /*!
              * \brief Move forward in a dialog, in response to an event like a space key pressed.
@@ -97,7 +117,8 @@ namespace OpMon {
             void pass();
 
             /*!
-             * \brief Display the dialog character by character until the 3 lines are fully displayed.
+             * \brief Display the dialog character by character until the 2 lines are fully displayed.
+             * \details The page is laid out only once, so a step only increases the number of vertices drawn.
              */
             void updateTextAnimation();
 
@@ -15,6 +15,7 @@ File under GNU GPL v3.0 license
 #include <SFML/Graphics/Vertex.hpp>
 #include <cmath>
 
+#include "Window.hpp"
 #include "src/utils/ResourceLoader.hpp"
 
 /* Converts degrees to radians */
@@ -23,6 +24,25 @@ File under GNU GPL v3.0 license
 namespace OpMon {
     namespace Ui {
 
+        namespace {
+            MovementData baked(MovementData data, unsigned int time) {
+                data.x.bake(time);
+                data.y.bake(time);
+                return data;
+            }
+
+            RotationData baked(RotationData data, unsigned int time) {
+                data.formula.bake(time);
+                return data;
+            }
+
+            ScaleData baked(ScaleData data, unsigned int time) {
+                data.x.bake(time);
+                data.y.bake(time);
+                return data;
+            }
+        } // namespace
+
         MapLayer::MapLayer(sf::Vector2i size, const int tilesCodes[],
                            sf::Texture &tileset)
             : tileset(tileset) {
@@ -76,7 +96,9 @@ namespace OpMon {
                                        RotationData const rd,
                                        ScaleData const sd,
                                        sf::Transform *sprite)
-            : time(time), md(md), rd(rd), sd(sd), sprite(sprite) {
+            : time(time), md(time != 0 ? baked(md, time) : md),
+              rd(time != 0 ? baked(rd, time) : rd),
+              sd(time != 0 ? baked(sd, time) : sd), sprite(sprite) {
             if(sprite != nullptr) {
                 attach(sprite, true);
             }
@@ -90,6 +112,7 @@ namespace OpMon {
                 return nullptr;
             }
             t = 0;
+            ended = false;
             sf::Transform *oldSprite = detach();
             this->sprite = sprite;
             return oldSprite;
@@ -101,66 +124,6 @@ namespace OpMon {
             return toReturn;
         }
 
-        float Transformation::calcFormula(std::vector<double> formula,
-                                          FormulaMode mode, int t) {
-            float toReturn = 0.0;
-            switch(mode) {
-                case FormulaMode::POLYNOMIAL:
-                    for(unsigned int i = 0; i < formula.size(); i++) {
-                        toReturn += formula[i] * pow((double)t, (double)i);
-                    }
-                    break;
-                case FormulaMode::MULTIFUNCTIONS:
-                    unsigned int i = 0;
-                    while(i < formula.size()) { // Warning : if an incorrect
-                                                // function is put here, with an
-                                                // incorrect size, it will very
-                                                // likely cause a segmentation
-                                                // fault and the game will crash.
-                        switch((int)round(formula[i])) {
-                            case F_NOTHING: //*1 function : {0, a} -> a
-                                toReturn += formula[i + 1];
-                                i += 2;
-                                break;
-                            case F_SINE: // Sine function : {1, a, b, c} ->
-                                         // a·sin(b·t + c)
-                                toReturn +=
-                                    (formula[i + 1] *
-                                     std::sin(formula[i + 2] * (double)t +
-                                              formula[i + 3]));
-                                i += 4;
-                                break;
-                            case F_COSINE: // Cosine function : {2, a, b, c} ->
-                                           // a·cos(b·t + c)
-                                toReturn +=
-                                    (formula[i + 1] *
-                                     std::cos(formula[i + 2] * (double)t +
-                                              formula[i + 3]));
-                                i += 4;
-                                break;
-                            case F_ABS: // Absolute value function : {3, a, b,
-                                        // c} -> a·|b·t + c|
-                                toReturn +=
-                                    (formula[i + 1] *
-                                     std::abs(formula[i + 2] * (double)t +
-                                              formula[i + 3]));
-                                i += 4;
-                                break;
-                            case F_POW: // Power function : {4, a, b, c} -> a·(t
-                                        // + b)^c
-                                toReturn +=
-                                    (formula[i + 1] *
-                                     std::pow((double)t + formula[i + 2],
-                                              formula[i + 3]));
-                                t += 4;
-                                break;
-                        }
-                    }
-                    break;
-            }
-            return toReturn;
-        }
-
         sf::Vector2f Transformation::rotateVector(const sf::Vector2f &vect,
                                                   double angle) {
             return sf::Vector2f(((vect.x * std::cos(angle DEG)) -
@@ -171,17 +134,20 @@ namespace OpMon {
 
         bool Transformation::empty() { return sprite == nullptr; }
 
-        bool Transformation::apply() {
-            if(empty() || (t > time && time != 0)) {
+        bool Transformation::apply(unsigned int elapsed) {
+            if(empty() || ended) {
                 return false;
             }
+            t = elapsed * Window::FRAMERATE / 1000;
+            if(time != 0 && t >= time) {
+                t = time;
+                ended = true;
+            }
 
             // Translation
             if(md.init) {
                 sf::Vector2f calc = sf::Vector2f(
-                    calcFormula(md.xformula, md.modeX, t),
-                    calcFormula(md.yformula, md.modeY,
-                                t)); // Calculates the new coordinates
+                    md.x(t), md.y(t)); // Calculates the new coordinates
                 sprite->translate(rotateVector(
                     calc - lastTranslation,
                     -lastRotation)); // Moves by the difference between the old
@@ -193,7 +159,7 @@ namespace OpMon {
 
             // Rotation
             if(rd.init) {
-                float rotation = calcFormula(rd.formula, rd.formulaMode, t);
+                float rotation = rd.formula(t);
                 sprite->rotate(rotation - lastRotation, rd.origin);
                 lastRotation = rotation;
             }
@@ -201,9 +167,7 @@ namespace OpMon {
             // Scaling
             if(sd.init) {
                 sf::Vector2f calc =
-                    sf::Vector2f(calcFormula(sd.xformula, sd.modeX, t),
-                                 calcFormula(sd.yformula, sd.modeY,
-                                             t)); // Calculates the new scale
+                    sf::Vector2f(sd.x(t), sd.y(t)); // Calculates the new scale
                 sprite->scale(
                     calc.x / lastScaling.x, calc.y / lastScaling.y, sd.origin.x,
                     sd.origin.y); // Scaling relatively to the last scale to not
@@ -211,8 +175,6 @@ namespace OpMon {
                 lastScaling = calc;
             }
 
-            t++;
-
             return true;
         }
 
@@ -220,10 +182,8 @@ namespace OpMon {
             FormulaMode modeX, FormulaMode modeY, std::vector<double> xformula,
             std::vector<double> yformula, bool relative) {
             MovementData toReturn;
-            toReturn.modeX = modeX;
-            toReturn.modeY = modeY;
-            toReturn.xformula = xformula;
-            toReturn.yformula = yformula;
+            toReturn.x = Formula(modeX, xformula);
+            toReturn.y = Formula(modeY, yformula);
             toReturn.relative = relative;
             toReturn.init = true;
             return toReturn;
@@ -233,8 +193,7 @@ namespace OpMon {
             FormulaMode formulaMode, std::vector<double> formula,
             sf::Vector2f origin) {
             RotationData toReturn;
-            toReturn.formulaMode = formulaMode;
-            toReturn.formula = formula;
+            toReturn.formula = Formula(formulaMode, formula);
             toReturn.origin = origin;
             toReturn.init = true;
             return toReturn;
@@ -244,63 +203,20 @@ namespace OpMon {
             FormulaMode modeX, FormulaMode modeY, std::vector<double> xformula,
             std::vector<double> yformula, sf::Vector2f origin) {
             ScaleData toReturn;
-            toReturn.modeX = modeX;
-            toReturn.modeY = modeY;
-            toReturn.xformula = xformula;
-            toReturn.yformula = yformula;
+            toReturn.x = Formula(modeX, xformula);
+            toReturn.y = Formula(modeY, yformula);
             toReturn.init = true;
             toReturn.origin = origin;
             return toReturn;
         }
 
-        std::vector<double> Transformation::inverseFormula(
-            std::vector<double> formula, FormulaMode mode) {
-            std::vector<double> toReturn;
-            switch(mode) {
-                case FormulaMode::POLYNOMIAL:
-                    for(unsigned int i = 0; i < formula.size(); i++) {
-                        formula[i] = 0.0 - formula[i];
-                    }
-                    break;
-
-                case FormulaMode::MULTIFUNCTIONS:
-                    int jump = 0;
-                    for(unsigned int i = 0; i < formula.size(); i++) {
-                        if(formula[i] == 0) {
-                            jump = 2;
-                        } else {
-                            jump = 4;
-                        }
-                        for(int j = 1; j < jump; j++) {
-                            formula[i + j] = -formula[i + j];
-                        }
-                        i += jump;
-                    }
-                    break;
-            }
-            return toReturn;
-        }
-
         Transformation Transformation::inverse() {
-            std::vector<double> xformula;
-            std::vector<double> yformula;
-            std::vector<double> rotFormula;
-            if(md.init) {
-                xformula = inverseFormula(md.xformula, md.modeX);
-                yformula = inverseFormula(md.yformula, md.modeY);
-            }
-            if(rd.init) {
-                rotFormula = inverseFormula(rd.formula, rd.formulaMode);
-            }
-            return Transformation(
-                time,
-                md.init ? newMovementData(md.modeX, md.modeY, xformula,
-                                          yformula, md.relative) :
-                          md,
-                rd.init ?
-                    newRotationData(rd.formulaMode, rotFormula, rd.origin) :
-                    rd,
-                sd, sprite);
+            MovementData inversedMd = md;
+            RotationData inversedRd = rd;
+            inversedMd.x = -md.x;
+            inversedMd.y = -md.y;
+            inversedRd.formula = -rd.formula;
+            return Transformation(time, inversedMd, inversedRd, sd, sprite);
         }
 
         sf::Vector2f Transformation::spriteCenter(const sf::Sprite &spr) {
@@ -8,35 +8,13 @@
 #ifndef ELEMENTS_HPP
 #define ELEMENTS_HPP
 
-/*!
- * \brief ·1 function : {F_NOTHING, a} -> a
- */
-#define F_NOTHING 0
-/*!
- * \brief Sine function : {1, a, b, c} -> a·sin(b·t + c)
- * \warning The sine function is in radians.
- */
-#define F_SINE 1
-/*!
- * \brief Cosine function : {2, a, b, c} -> a·cos(b·t + c)
- * \warning The cosine function is in radians.
- */
-#define F_COSINE 2
-/*!
- * \brief Absolute value function : {3, a, b, c} -> a·|b·t + c|
- */
-#define F_ABS 3
-/*!
- * \brief Power function : {4, a, b, c} -> a·(t + b)^c
- */
-#define F_POW 4
-
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 
 #include "../../core/Player.hpp"
+#include "Formula.hpp"
 
 namespace sf {
     class RenderTarget;
@@ -81,55 +59,19 @@ namespace OpMon {
                      sf::Texture &tileset);
         };
 
-        /*!
-         * \brief The different types of formulas used in MovementData.
-         */
-        enum class FormulaMode : unsigned int {
-            /*!
-             * A polynomial formula. Each element of the array will be
-             * interpreted as the coefficient of the variable put to the power
-             * of the index of the element in the array. Exemple : {2, 8, 1, 6,
-             * 9} will be interpreted as 2 + 8t + t^2 + 6t^3 + 9t^4.
-             */
-            POLYNOMIAL = 0,
-            /*!
-             * A formula using different base fonctions. The interpretation will
-             * change according to the chosen function. Exemple : {#F_SINE, 2,
-             * 3, -5, #F_ABS, -3, 4, -2} will be interpreted as 2sin(3t - 5) -
-             * 3·|4t - 2| List of currently available functions : #F_NOTHING
-             * #F_SINE
-             * #F_COSINE
-             * #F_ABS
-             * #F_POW
-             * See the documentation of each one to see how to use it.
-             */
-            MULTIFUNCTIONS = 1
-        };
-
         /*!
          * \brief A structure containing information about a translation.
          * \todo Unify MovementData, RotationData and ScaleData in one formula.
          */
         struct MovementData {
             /*!
-             * \brief The type of the formula giving the x coordinate as a function of t.
-             */
-            FormulaMode modeX;
-            /*!
-             * \brief The type of the formula giving the y coordinate as a function of t.
+             * \brief The formula giving the x coordinate as a function of t.
              */
-            FormulaMode modeY;
-
-            /*!
-             * \brief The array containing the formula giving the x coordinate as a function of t.
-             * \details The format is detailed in the documentation of FormulaMode.
-             */
-            std::vector<double> xformula;
+            Formula x;
             /*!
-             * \brief The array containing the formula giving the y coordinate as a function of t.
-             * \details The format is detailed in the documentation of FormulaMode.
+             * \brief The formula giving the y coordinate as a function of t.
              */
-            std::vector<double> yformula;
+            Formula y;
             /*!
              * \brief If `true`, the movement will be relative to the object current position.
              */
@@ -149,12 +91,7 @@ namespace OpMon {
             /*!
              * \brief Formula giving the angle of rotation (in degrees) as a function of t.
              */
-            std::vector<double> formula;
-
-            /*!
-             * \brief The type of the formula giving the angle of rotation.
-             */
-            FormulaMode formulaMode;
+            Formula formula;
 
             /*!
              * \brief Origin of the rotation.
@@ -171,22 +108,14 @@ namespace OpMon {
          * \todo Unify MovementData, RotationData and ScaleData in one formula.
          */
         struct ScaleData {
-            /*!
-             * \brief The type of the formula giving the horizontal scaling as a function of t.
-             */
-            FormulaMode modeX = FormulaMode::POLYNOMIAL;
-            /*!
-             * \brief The type of the formula giving the vertical scaling as a function of t.
-             */
-            FormulaMode modeY = FormulaMode::POLYNOMIAL;
             /*!
              * \brief The formula giving the horizontal stretching as a function of t.
              */
-            std::vector<double> xformula;
+            Formula x;
             /*!
              * \brief The formula giving the vertical stretching as a function of t.
              */
-            std::vector<double> yformula;
+            Formula y;
 
             /*!
              * \brief Origin of the rotation.
@@ -216,9 +145,13 @@ namespace OpMon {
             const unsigned int time;
 
             /*!
-             * \brief The variable used, corresponding to the number of frames elapsed.
+             * \brief The variable used, corresponding to the number of frames elapsed at Window::FRAMERATE.
              */
             unsigned int t = 0;
+            /*!
+             * \brief If `true`, the movement has been applied at its end.
+             */
+            bool ended = false;
             /*!
              * \brief The data for the a translation.
              */
@@ -249,15 +182,6 @@ namespace OpMon {
              */
             sf::Vector2f lastScaling = sf::Vector2f(1.0, 1.0);
 
-            /*!
-             * \brief Calculates the value of the formula for a given value of t.
-             * \param formula The formula to calculate.
-             * \param mode The type of formula.
-             * \param t The value of t.
-             * \returns The value of the formula with the given value of t.
-             */
-            float calcFormula(std::vector<double> formula, FormulaMode mode,
-                              int t);
             /*!
              * \brief Rotates a vector.
              * \param vect The vector to rotate.
@@ -266,17 +190,11 @@ namespace OpMon {
              */
             sf::Vector2f rotateVector(sf::Vector2f const &vect, double angle);
 
-            /*!
-             * \brief Reverses the sign of some coefficients to mirror the formula.
-             * \returns The mirrored formula.
-             */
-            std::vector<double> inverseFormula(std::vector<double> formula,
-                                               FormulaMode mode);
-
           public:
             /*!
              * \brief Constructs an animation.
-             * \param time The duration of the animation, in frames.
+             * \details If the duration is limited, all the values of the formulas are computed here, and apply() only reads them.
+             * \param time The duration of the animation, in frames at Window::FRAMERATE.
              * \param md The data of the translation.
              * \param rd The data of the rotation.
              * \param sd The data of the scaling.
@@ -310,21 +228,23 @@ namespace OpMon {
             bool empty();
 
             /*!
-             * \brief Apply the movement to the attached sprite, incrementing t and calculating the new coordinates.
-             * \returns `false` if t reached the time limit or if no sprite is attached, `true` otherwise.
+             * \brief Apply the movement to the attached sprite, calculating the coordinates at the given time.
+             * \details The formulas are evaluated at the frame reached at Window::FRAMERATE, so the animation lasts as long whatever the real framerate is. The last call before the time limit applies the movement at its end.
+             * \param elapsed The number of game milliseconds elapsed since the sprite has been attached (see Utils::Time::getGameMilliseconds()).
+             * \returns `false` if the end has already been applied or if no sprite is attached, `true` otherwise.
              */
-            bool apply();
+            bool apply(unsigned int elapsed);
 
             /*!
              * \brief Shortcut for apply().
              */
-            bool operator()() { return apply(); }
+            bool operator()(unsigned int elapsed) { return apply(elapsed); }
 
             virtual ~Transformation();
 
             /*!
              * \brief Returns a inversed version of the animation (for the other OpMon in the battle).
-             * \details See Transformation::inverseFormula
+             * \details The translation and the rotation are mirrored, the scaling is kept.
              */
             Transformation inverse();
             /*!
@@ -334,20 +254,20 @@ namespace OpMon {
             static sf::Vector2f spriteCenter(sf::Sprite const &spr);
 
             /*!
-             * \brief Creates a new MovementData.
+             * \brief Creates a new MovementData, compiling its formulas.
              */
             static const MovementData newMovementData(
                 FormulaMode modeX, FormulaMode modeY,
                 std::vector<double> xformula, std::vector<double> yformula,
                 bool relative = true);
             /*!
-             * \brief Creates a new RotationData.
+             * \brief Creates a new RotationData, compiling its formula.
              */
             static const RotationData newRotationData(
                 FormulaMode formulaMode, std::vector<double> formula,
                 sf::Vector2f origin);
             /*!
-             * \brief Creates a new ScaleData.
+             * \brief Creates a new ScaleData, compiling its formulas.
              */
             static const ScaleData newScaleData(FormulaMode modeX,
                                                 FormulaMode modeY,
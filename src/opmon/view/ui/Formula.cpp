@@ -0,0 +1,140 @@
+/*
+Formula.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "Formula.hpp"
+
+#include <cmath>
+#include <string>
+
+#include "src/utils/log.hpp"
+
+namespace OpMon {
+    namespace Ui {
+
+        namespace {
+            /*!
+             * \brief The maximal number of values computed by Formula::bake(). The longer formulas are computed each frame.
+             */
+            constexpr unsigned int MAX_BAKED_VALUES = 4096;
+        } // namespace
+
+        Formula::Formula(FormulaMode mode,
+                         std::vector<double> const &coefficients) {
+            auto compiled = std::make_shared<Program>();
+            switch(mode) {
+                case FormulaMode::POLYNOMIAL:
+                    compiled->polynomial = coefficients;
+                    // The zero terms of the highest degrees are useless
+                    while(!compiled->polynomial.empty() &&
+                          compiled->polynomial.back() == 0) {
+                        compiled->polynomial.pop_back();
+                    }
+                    break;
+                case FormulaMode::MULTIFUNCTIONS: {
+                    double constant = 0;
+                    unsigned int i = 0;
+                    while(i < coefficients.size()) {
+                        int function = (int)std::round(coefficients[i]);
+                        unsigned int size = function == F_NOTHING ? 2 : 4;
+                        if(function < F_NOTHING || function > F_POW ||
+                           i + size > coefficients.size()) {
+                            Utils::Log::warn(
+                                "Incorrect or incomplete function " +
+                                std::to_string(function) +
+                                " in an animation formula. The end of the "
+                                "formula is ignored.");
+                            break;
+                        }
+                        if(function == F_NOTHING) {
+                            constant += coefficients[i + 1];
+                        } else {
+                            compiled->terms.push_back(
+                                {(unsigned int)function, coefficients[i + 1],
+                                 coefficients[i + 2], coefficients[i + 3]});
+                        }
+                        i += size;
+                    }
+                    if(constant != 0) {
+                        compiled->polynomial.push_back(constant);
+                    }
+                    break;
+                }
+            }
+            if(!compiled->polynomial.empty() || !compiled->terms.empty()) {
+                program = std::move(compiled);
+            }
+        }
+
+        double Formula::compute(unsigned int t) const {
+            double x = t;
+            double result = 0;
+            // Horner's method
+            for(auto coef = program->polynomial.rbegin();
+                coef != program->polynomial.rend(); ++coef) {
+                result = result * x + *coef;
+            }
+            for(Term const &term : program->terms) {
+                switch(term.function) {
+                    case F_SINE:
+                        result += term.a * std::sin(term.b * x + term.c);
+                        break;
+                    case F_COSINE:
+                        result += term.a * std::cos(term.b * x + term.c);
+                        break;
+                    case F_ABS:
+                        result += term.a * std::abs(term.b * x + term.c);
+                        break;
+                    case F_POW:
+                        result += term.a * std::pow(x + term.b, term.c);
+                        break;
+                }
+            }
+            return result;
+        }
+
+        float Formula::operator()(unsigned int t) const {
+            if(program == nullptr) {
+                return 0;
+            }
+            if(t < program->baked.size()) {
+                return program->baked[t];
+            }
+            return compute(t);
+        }
+
+        void Formula::bake(unsigned int time) {
+            if(program == nullptr || time >= MAX_BAKED_VALUES ||
+               time < program->baked.size()) {
+                return;
+            }
+            auto baked = std::make_shared<Program>(*program);
+            baked->baked.resize(time + 1);
+            for(unsigned int t = 0; t <= time; t++) {
+                baked->baked[t] = compute(t);
+            }
+            program = std::move(baked);
+        }
+
+        Formula Formula::operator-() const {
+            Formula opposite;
+            if(program == nullptr) {
+                return opposite;
+            }
+            auto negated = std::make_shared<Program>(*program);
+            for(double &coef : negated->polynomial) {
+                coef = -coef;
+            }
+            for(Term &term : negated->terms) {
+                term.a = -term.a;
+            }
+            for(float &value : negated->baked) {
+                value = -value;
+            }
+            opposite.program = std::move(negated);
+            return opposite;
+        }
+
+    } // namespace Ui
+} // namespace OpMon
@@ -0,0 +1,129 @@
+/*!
+ * \file Formula.hpp
+ * \brief Formulas used by the animations, compiled when they are loaded.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+/*!
+ * \brief ·1 function : {F_NOTHING, a} -> a
+ */
+#define F_NOTHING 0
+/*!
+ * \brief Sine function : {1, a, b, c} -> a·sin(b·t + c)
+ * \warning The sine function is in radians.
+ */
+#define F_SINE 1
+/*!
+ * \brief Cosine function : {2, a, b, c} -> a·cos(b·t + c)
+ * \warning The cosine function is in radians.
+ */
+#define F_COSINE 2
+/*!
+ * \brief Absolute value function : {3, a, b, c} -> a·|b·t + c|
+ */
+#define F_ABS 3
+/*!
+ * \brief Power function : {4, a, b, c} -> a·(t + b)^c
+ */
+#define F_POW 4
+
+#include <memory>
+#include <vector>
+
+namespace OpMon {
+    namespace Ui {
+
+        /*!
+         * \brief The different types of formulas used in MovementData.
+         */
+        enum class FormulaMode : unsigned int {
+            /*!
+             * A polynomial formula. Each element of the array will be
+             * interpreted as the coefficient of the variable put to the power
+             * of the index of the element in the array. Exemple : {2, 8, 1, 6,
+             * 9} will be interpreted as 2 + 8t + t^2 + 6t^3 + 9t^4.
+             */
+            POLYNOMIAL = 0,
+            /*!
+             * A formula using different base fonctions. The interpretation will
+             * change according to the chosen function. Exemple : {#F_SINE, 2,
+             * 3, -5, #F_ABS, -3, 4, -2} will be interpreted as 2sin(3t - 5) -
+             * 3·|4t - 2| List of currently available functions : #F_NOTHING
+             * #F_SINE
+             * #F_COSINE
+             * #F_ABS
+             * #F_POW
+             * See the documentation of each one to see how to use it.
+             */
+            MULTIFUNCTIONS = 1
+        };
+
+        /*!
+         * \brief A formula giving a value as a function of t, the number of frames elapsed.
+         * \details The array describing the formula is read once, when the formula is constructed: a polynomial is stored to be evaluated with Horner's method, and the functions of a multifunction formula are decoded in a list of terms, with their constants added together. If the formula is only used for a known duration, bake() computes all its values in a table.
+         *
+         * Evaluating a formula never allocates memory. The compiled formula is shared between the copies, so copying a formula is cheap.
+         */
+        class Formula {
+          public:
+            /*!
+             * \brief Creates a formula always equal to 0.
+             */
+            Formula() = default;
+
+            /*!
+             * \brief Compiles a formula.
+             * \details The format of `coefficients` is detailed in the documentation of FormulaMode. The unknown or incomplete functions of a multifunction formula are reported in the log and ignored.
+             */
+            Formula(FormulaMode mode, std::vector<double> const &coefficients);
+
+            /*!
+             * \returns The value of the formula for the given value of t.
+             */
+            float operator()(unsigned int t) const;
+
+            /*!
+             * \brief Computes the values of the formula for t from 0 to `time`, so that evaluating them only reads a table.
+             */
+            void bake(unsigned int time);
+
+            /*!
+             * \returns The opposite of the formula, used to mirror an animation.
+             */
+            Formula operator-() const;
+
+          private:
+            /*!
+             * \brief A function of a multifunction formula: a·f(b·t + c), or a·(t + b)^c for #F_POW.
+             */
+            struct Term {
+                unsigned int function;
+                double a;
+                double b;
+                double c;
+            };
+
+            struct Program {
+                /*!
+                 * \brief The coefficients of the polynomial, from the constant one.
+                 */
+                std::vector<double> polynomial;
+                std::vector<Term> terms;
+                /*!
+                 * \brief The values computed by bake(), indexed by t.
+                 */
+                std::vector<float> baked;
+            };
+
+            double compute(unsigned int t) const;
+
+            /*!
+             * \brief The compiled formula. `nullptr` for a formula equal to 0.
+             */
+            std::shared_ptr<const Program> program;
+        };
+
+    } // namespace Ui
+} // namespace OpMon
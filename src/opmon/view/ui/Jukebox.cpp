@@ -20,7 +20,11 @@ namespace OpMon {
                 auto music = Utils::ResourceLoader::loadMusic(path.c_str());
                 music->setVolume(globalVolume);
                 music->setLoop(loop);
-                musList[name] = std::move(music);
+                unsigned int index = MusicId::intern(name).getIndex();
+                if(index >= musList.size()) {
+                    musList.resize(index + 1);
+                }
+                musList[index] = std::move(music);
             } catch(Utils::LoadingException &e) {
                 Utils::Log::oplog(e.desc(), true);
                 Utils::Log::warn(std::string("Music '") + name +
@@ -36,10 +40,15 @@ namespace OpMon {
                 auto sb = std::make_unique<sf::SoundBuffer>();
                 Utils::ResourceLoader::load(*sb, path.c_str());
 
-                soundsList[name].first = std::move(sb);
-                soundsList[name].second = std::make_unique<sf::Sound>();
-                soundsList[name].second->setBuffer(*soundsList[name].first);
-                soundsList[name].second->setVolume(globalVolume);
+                unsigned int index = SoundId::intern(name).getIndex();
+                if(index >= soundsList.size()) {
+                    soundsList.resize(index + 1);
+                }
+                auto &entry = soundsList[index];
+                entry.first = std::move(sb);
+                entry.second = std::make_unique<sf::Sound>();
+                entry.second->setBuffer(*entry.first);
+                entry.second->setVolume(globalVolume);
             } catch(Utils::LoadingException &e) {
                 Utils::Log::oplog(e.desc(), true);
                 Utils::Log::warn(std::string("Sound '") + name +
@@ -47,8 +56,11 @@ namespace OpMon {
             }
         }
 
-        void Jukebox::play(const std::string &music) {
-            if(musList[music].get() == playing) {
+        void Jukebox::play(MusicId music) {
+            sf::Music *toPlay = music.getIndex() < musList.size()
+                                    ? musList[music.getIndex()].get()
+                                    : nullptr;
+            if(toPlay == playing) {
                 return;
             }
 
@@ -56,13 +68,15 @@ namespace OpMon {
                 playing->stop();
             }
 
-            if(musList[music].get() == nullptr) {
-                Utils::Log::warn(std::string("Unknown music '") + music + "'");
+            if(toPlay == nullptr) {
+                Utils::Log::warn(std::string("Unknown music '") +
+                                 music.getName() + "'");
+                playing = nullptr;
                 return;
             }
 
-            musList.at(music)->play();
-            playing = musList.at(music).get();
+            toPlay->play();
+            playing = toPlay;
         }
 
         void Jukebox::pause() {
@@ -86,22 +100,27 @@ namespace OpMon {
                 return;
             }
 
-            for(auto itor = musList.begin(); itor != musList.end(); ++itor) {
-                itor->second->setVolume(globalVolume);
+            for(auto &music : musList) {
+                if(music != nullptr) {
+                    music->setVolume(globalVolume);
+                }
             }
-            for(auto itor = soundsList.begin(); itor != soundsList.end();
-                ++itor) {
-                itor->second.second->setVolume(globalVolume);
+            for(auto &sound : soundsList) {
+                if(sound.second != nullptr) {
+                    sound.second->setVolume(globalVolume);
+                }
             }
             this->globalVolume = globalVolume;
         }
 
-        void Jukebox::playSound(const std::string &sound) {
-            if(soundsList[sound].first.get() == nullptr) {
-                Utils::Log::warn(std::string("Unknown sound '") + sound + "'");
+        void Jukebox::playSound(SoundId sound) {
+            if(sound.getIndex() >= soundsList.size() ||
+               soundsList[sound.getIndex()].first == nullptr) {
+                Utils::Log::warn(std::string("Unknown sound '") +
+                                 sound.getName() + "'");
                 return;
             }
-            soundsList.at(sound).second->play();
+            soundsList[sound.getIndex()].second->play();
         }
 
         int Jukebox::getGlobalVolume() const { return globalVolume; }
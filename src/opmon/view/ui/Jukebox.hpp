@@ -16,9 +16,10 @@
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "src/opmon/core/Ids.hpp"
 #include "src/utils/ResourceLoader.hpp"
 
 namespace sf {
@@ -36,15 +37,16 @@ namespace OpMon {
         class Jukebox {
           private:
             /*!
-             * \brief A map of the different musics in the game.
+             * \brief The different musics in the game, indexed by MusicId.
+             * \details An entry is nullptr if the music failed to load.
              */
-            std::unordered_map<std::string, std::unique_ptr<sf::Music>> musList;
+            std::vector<std::unique_ptr<sf::Music>> musList;
             /*!
-             * \brief A map of the different sounds in the game.
+             * \brief The different sounds in the game, indexed by SoundId.
+             * \details An entry contains nullptr if the sound failed to load.
              */
-            std::unordered_map<std::string,
-                               std::pair<std::unique_ptr<sf::SoundBuffer>,
-                                         std::unique_ptr<sf::Sound>>>
+            std::vector<std::pair<std::unique_ptr<sf::SoundBuffer>,
+                                  std::unique_ptr<sf::Sound>>>
                 soundsList;
             /*!
              * \brief A pointer to the currently playing music.
@@ -70,10 +72,18 @@ namespace OpMon {
 
             /*!
              * \brief Plays the selected music.
-             * \param music The string identifier of the music.
+             * \param music The identifier of the music.
              * \details If the music to play is already playing, the method will not restart the music. The method will replace any other music currently playing.
              */
-            void play(const std::string &music);
+            void play(MusicId music);
+            /*!
+             * \brief Plays the selected music.
+             * \param music The string identifier of the music.
+             * \details Resolves the string on every call. Objects playing a music repeatedly should keep its MusicId instead.
+             */
+            void play(const std::string &music) {
+                play(MusicId::find(music));
+            }
             /*!
              * \brief Pauses the current music.
              */
@@ -86,11 +96,19 @@ namespace OpMon {
             void setGlobalVolume(float globalVolume);
             int getGlobalVolume() const;
 
+            /*!
+             * \brief Plays the selected sound.
+             * \param sound The identifier of the sound to play.
+             */
+            void playSound(SoundId sound);
             /*!
              * \brief Plays the selected sound.
              * \param sound The string identifier of the sound to play.
+             * \details Resolves the string on every call. Objects playing a sound repeatedly should keep its SoundId instead.
              */
-            void playSound(const std::string &sound);
+            void playSound(const std::string &sound) {
+                playSound(SoundId::find(sound));
+            }
             /*!
              * \brief Adds a sound to the jukebox.
              * \param name The string to associate with the sound.
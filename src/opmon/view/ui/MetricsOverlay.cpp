@@ -0,0 +1,76 @@
+/*
+MetricsOverlay.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "MetricsOverlay.hpp"
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <cstdio>
+#include <string>
+
+#include "src/utils/FrameMetrics.hpp"
+#include "src/utils/time.hpp"
+
+namespace OpMon {
+    namespace Ui {
+
+        MetricsOverlay::MetricsOverlay(sf::Font const &font) {
+            text.setFont(font);
+            text.setCharacterSize(14);
+            text.setFillColor(sf::Color::White);
+            text.setPosition(8, 6);
+            background.setFillColor(sf::Color(0, 0, 0, 170));
+            background.setPosition(0, 0);
+        }
+
+        void MetricsOverlay::update() {
+            int now = Utils::Time::getElapsedMilliseconds();
+            if(!visible || now - lastUpdate < 500) {
+                return;
+            }
+            lastUpdate = now;
+
+            using Utils::FrameMetrics;
+            FrameMetrics const &metrics = FrameMetrics::getInstance();
+            std::string str = "ms        p50    p95    p99    max\n";
+            char line[64];
+            for(int i = 0; i < FrameMetrics::PHASE_COUNT; i++) {
+                FrameMetrics::Stats stats =
+                    metrics.getRecent((FrameMetrics::Phase)i);
+                std::snprintf(line, sizeof(line),
+                              "%-8s %6.2f %6.2f %6.2f %6.2f\n",
+                              FrameMetrics::getName((FrameMetrics::Phase)i),
+                              stats.p50, stats.p95, stats.p99, stats.max);
+                str += line;
+            }
+            FrameMetrics::Stats drawCalls =
+                metrics.getRecent(FrameMetrics::OVERWORLD_DRAW_CALLS);
+            FrameMetrics::Stats events =
+                metrics.getRecent(FrameMetrics::EVENT_COUNT);
+            std::snprintf(line, sizeof(line),
+                          "overworld draws %.0f (max %.0f)\n", drawCalls.p50,
+                          drawCalls.max);
+            str += line;
+            std::snprintf(line, sizeof(line), "events %.0f (max %.0f)",
+                          events.p50, events.max);
+            str += line;
+            text.setString(str);
+
+            sf::FloatRect bounds = text.getLocalBounds();
+            background.setSize(sf::Vector2f(bounds.left + bounds.width + 16,
+                                            bounds.top + bounds.height + 12));
+        }
+
+        void MetricsOverlay::draw(sf::RenderTarget &target,
+                                  sf::RenderStates states) const {
+            if(!visible) {
+                return;
+            }
+            target.draw(background, states);
+            target.draw(text, states);
+        }
+
+    } // namespace Ui
+} // namespace OpMon
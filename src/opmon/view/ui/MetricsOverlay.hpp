@@ -0,0 +1,54 @@
+/*!
+ * \file MetricsOverlay.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+namespace sf {
+    class Font;
+    class RenderTarget;
+} // namespace sf
+
+namespace OpMon {
+    namespace Ui {
+
+        /*!
+         * \brief Shows the statistics of Utils::FrameMetrics over the game.
+         * \details The text is only rebuilt twice per second, so showing the overlay costs two draw calls per frame.
+         */
+        class MetricsOverlay : public sf::Drawable {
+          public:
+            explicit MetricsOverlay(sf::Font const &font);
+
+            /*!
+             * \brief Shows or hides the overlay.
+             */
+            void toggle() { visible = !visible; }
+            bool isVisible() const { return visible; }
+
+            /*!
+             * \brief Rebuilds the text if it is visible and hasn't been updated recently.
+             */
+            void update();
+
+          private:
+            virtual void draw(sf::RenderTarget &target,
+                              sf::RenderStates states) const;
+
+            sf::Text text;
+            sf::RectangleShape background;
+            bool visible = false;
+            /*!
+             * \brief The time of the last update of the text, in milliseconds.
+             */
+            int lastUpdate = -1000;
+        };
+
+    } // namespace Ui
+} // namespace OpMon
@@ -0,0 +1,125 @@
+/*
+Timeline.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "Timeline.hpp"
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace OpMon {
+    namespace Ui {
+
+        float ease(Easing easing, float p) {
+            switch(easing) {
+                case Easing::STEP:
+                    return p < 1 ? 0 : 1;
+                case Easing::LINEAR:
+                    return p;
+                case Easing::QUAD_IN:
+                    return p * p;
+                case Easing::QUAD_OUT:
+                    return p * (2 - p);
+                case Easing::QUAD_IN_OUT:
+                    return p < 0.5f ? 2 * p * p : 1 - 2 * (1 - p) * (1 - p);
+                case Easing::CUBIC_IN_OUT:
+                    return p < 0.5f ? 4 * p * p * p :
+                                      1 - 4 * (1 - p) * (1 - p) * (1 - p);
+            }
+            return p;
+        }
+
+        Timeline::Timeline(
+            std::vector<Track> tracks,
+            std::vector<std::shared_ptr<const sf::Texture>> frames)
+            : tracks(std::move(tracks)), frames(std::move(frames)) {
+            std::stable_sort(this->tracks.begin(), this->tracks.end(),
+                             [](Track const &a, Track const &b) {
+                                 return a.property < b.property;
+                             });
+            for(Track &track : this->tracks) {
+                std::stable_sort(track.keyframes.begin(), track.keyframes.end(),
+                                 [](Keyframe const &a, Keyframe const &b) {
+                                     return a.time < b.time;
+                                 });
+                if(!track.keyframes.empty()) {
+                    duration = std::max(duration, track.keyframes.back().time);
+                }
+            }
+        }
+
+        std::array<float, 4> Timeline::evaluate(Track const &track, int time) {
+            auto const &keyframes = track.keyframes;
+            if(keyframes.empty()) {
+                return {};
+            }
+            auto next = std::upper_bound(
+                keyframes.begin(), keyframes.end(), time,
+                [](int time, Keyframe const &keyframe) {
+                    return time < keyframe.time;
+                });
+            if(next == keyframes.begin()) {
+                return keyframes.front().value;
+            }
+            if(next == keyframes.end()) {
+                return keyframes.back().value;
+            }
+            Keyframe const &previous = *(next - 1);
+            float progress = ease(previous.easing,
+                                  float(time - previous.time) /
+                                      float(next->time - previous.time));
+            std::array<float, 4> value;
+            for(unsigned int i = 0; i < value.size(); i++) {
+                value[i] = previous.value[i] +
+                           (next->value[i] - previous.value[i]) * progress;
+            }
+            return value;
+        }
+
+        void Timeline::apply(sf::Sprite &sprite, int time) const {
+            for(Track const &track : tracks) {
+                std::array<float, 4> value = evaluate(track, time);
+                sf::Color color = sprite.getColor();
+                switch(track.property) {
+                    case TrackProperty::FRAME: {
+                        unsigned int frame = std::lround(value[0]);
+                        if(frame < frames.size() &&
+                           sprite.getTexture() != frames[frame].get()) {
+                            sprite.setTexture(*frames[frame], true);
+                        }
+                        break;
+                    }
+                    case TrackProperty::TEXTURE_RECT:
+                        sprite.setTextureRect(sf::IntRect(
+                            std::lround(value[0]), std::lround(value[1]),
+                            std::lround(value[2]), std::lround(value[3])));
+                        break;
+                    case TrackProperty::POSITION:
+                        sprite.setPosition(value[0], value[1]);
+                        break;
+                    case TrackProperty::SCALE:
+                        sprite.setScale(value[0], value[1]);
+                        break;
+                    case TrackProperty::ROTATION:
+                        sprite.setRotation(value[0]);
+                        break;
+                    case TrackProperty::COLOR:
+                        sprite.setColor(sf::Color(
+                            std::clamp(std::lround(value[0]), 0l, 255l),
+                            std::clamp(std::lround(value[1]), 0l, 255l),
+                            std::clamp(std::lround(value[2]), 0l, 255l),
+                            color.a));
+                        break;
+                    case TrackProperty::ALPHA:
+                        color.a = std::clamp(std::lround(value[0]), 0l, 255l);
+                        sprite.setColor(color);
+                        break;
+                }
+            }
+        }
+
+    } // namespace Ui
+} // namespace OpMon
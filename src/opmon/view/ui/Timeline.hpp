@@ -0,0 +1,117 @@
+/*!
+ * \file Timeline.hpp
+ * \brief Animations described by keyframes and evaluated with the elapsed time.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace sf {
+    class Sprite;
+    class Texture;
+} // namespace sf
+
+namespace OpMon {
+    namespace Ui {
+
+        /*!
+         * \brief The curves used to go from a keyframe to the next one.
+         */
+        enum class Easing {
+            STEP,        /*!< Keeps the value of the keyframe until the next one. */
+            LINEAR,      /*!< Constant speed. */
+            QUAD_IN,     /*!< Starts slowly, then accelerates. */
+            QUAD_OUT,    /*!< Starts fast, then decelerates. */
+            QUAD_IN_OUT, /*!< Accelerates, then decelerates. */
+            CUBIC_IN_OUT /*!< Like QUAD_IN_OUT, with a faster middle. */
+        };
+
+        /*!
+         * \brief Applies an easing curve.
+         * \param progress The progress between two keyframes, from 0 to 1.
+         * \returns The eased progress, from 0 to 1.
+         */
+        float ease(Easing easing, float progress);
+
+        /*!
+         * \brief The properties of a sprite which can be animated by a Track.
+         * \details The tracks are applied in this order, so that a texture change doesn't reset the other properties.
+         */
+        enum class TrackProperty {
+            FRAME,        /*!< {index} : The index of the texture in Timeline::frames. */
+            TEXTURE_RECT, /*!< {left, top, width, height} */
+            POSITION,     /*!< {x, y} */
+            SCALE,        /*!< {x, y} */
+            ROTATION,     /*!< {angle}, in degrees. */
+            COLOR,        /*!< {red, green, blue}, from 0 to 255. */
+            ALPHA         /*!< {alpha}, from 0 to 255. */
+        };
+
+        /*!
+         * \brief The value of a property at a given time.
+         */
+        struct Keyframe {
+            /*!
+             * \brief The time of the keyframe, in milliseconds since the beginning of the animation.
+             */
+            int time;
+            /*!
+             * \brief The value of the property. The number of used components depends on the property (see TrackProperty).
+             */
+            std::array<float, 4> value;
+            /*!
+             * \brief The curve used to go from this keyframe to the next one.
+             */
+            Easing easing = Easing::LINEAR;
+        };
+
+        /*!
+         * \brief The keyframes animating a property.
+         */
+        struct Track {
+            TrackProperty property;
+            std::vector<Keyframe> keyframes;
+        };
+
+        /*!
+         * \brief An animation of a sprite, described as data.
+         * \details The animation is a set of tracks, each one interpolating a property of the sprite between its keyframes. It is evaluated with the time elapsed since its beginning, so it looks the same whatever the number of frames drawn per second. The textures shown by the animation are shared handles (see Utils::ResourceLoader::loadShared()), so the timelines don't hold copies of them.
+         */
+        class Timeline {
+          public:
+            /*!
+             * \param tracks The tracks of the animation. Their keyframes don't need to be sorted.
+             * \param frames The textures used by a TrackProperty::FRAME track.
+             */
+            explicit Timeline(
+                std::vector<Track> tracks,
+                std::vector<std::shared_ptr<const sf::Texture>> frames = {});
+
+            /*!
+             * \brief Sets the properties of a sprite to their value at the given time.
+             * \param time The time elapsed since the beginning of the animation, in milliseconds. Before the beginning and after the end, the values of the first or last keyframes are used.
+             */
+            void apply(sf::Sprite &sprite, int time) const;
+
+            /*!
+             * \returns The value of a track at the given time.
+             */
+            static std::array<float, 4> evaluate(Track const &track, int time);
+
+            /*!
+             * \returns The time of the last keyframe, in milliseconds.
+             */
+            int getDuration() const { return duration; }
+
+          private:
+            std::vector<Track> tracks;
+            std::vector<std::shared_ptr<const sf::Texture>> frames;
+            int duration = 0;
+        };
+
+    } // namespace Ui
+} // namespace OpMon
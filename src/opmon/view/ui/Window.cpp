@@ -9,6 +9,7 @@ File under GNU GPL v3.0 license
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/View.hpp>
+#include <SFML/System/Sleep.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/VideoMode.hpp>
@@ -27,11 +28,9 @@ namespace OpMon {
     namespace Ui {
         void Window::open(Utils::OptionsSave &options) {
             sf::ContextSettings settings;
-            if(!options.checkParam("fullscreen")) {
-                options.addOrModifParam("fullscreen", "false");
-            }
+            options.setDefault("fullscreen", false);
             // settings.antialiasingLevel = 1;
-            if(options.getParam("fullscreen").getValue() == "true") {
+            if(options.getBool("fullscreen")) {
                 fullScreen = true;
                 window.create(sf::VideoMode::getFullscreenModes().at(0),
                               "OpMon Lazuli", sf::Style::Fullscreen, settings);
@@ -53,7 +52,7 @@ namespace OpMon {
 
             oplog("Window initialized!");
             // window.setVerticalSyncEnabled(true);
-            window.setFramerateLimit(30);
+            window.setFramerateLimit(FRAMERATE);
             window.setKeyRepeatEnabled(false);
         }
 
@@ -68,11 +67,46 @@ namespace OpMon {
             open(options);
         }
 
-        void Window::refresh() {
+        void Window::refresh(sf::Drawable const *overlay) {
             frame.display();
             window.clear(sf::Color::Black);
             window.draw(sprite);
+            if(overlay != nullptr) {
+                window.draw(*overlay, sprite.getTransform());
+            }
             window.display();
+            frameClock.restart();
+        }
+
+        void Window::idle() {
+            sf::Time remaining =
+                sf::seconds(1.f / FRAMERATE) - frameClock.getElapsedTime();
+            if(remaining > sf::Time::Zero) {
+                sf::sleep(remaining);
+            }
+            frameClock.restart();
+        }
+
+        std::shared_ptr<const sf::RenderTexture> Window::snapshot() {
+            std::shared_ptr<sf::RenderTexture> texture;
+            for(auto const &pooled : snapshots) {
+                if(pooled.use_count() == 1) {
+                    texture = pooled;
+                    break;
+                }
+            }
+            if(texture == nullptr) {
+                texture = std::make_shared<sf::RenderTexture>();
+                snapshots.push_back(texture);
+            }
+            if(texture->getSize() != frame.getSize()) {
+                texture->create(frame.getSize().x, frame.getSize().y);
+            }
+            frame.display();
+            texture->clear(sf::Color::Black);
+            texture->draw(sf::Sprite(frame.getTexture()));
+            texture->display();
+            return texture;
         }
 
         void Window::updateView() {
@@ -10,6 +10,9 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/System/Clock.hpp>
+#include <memory>
+#include <vector>
 
 #include "src/utils/OptionsSave.hpp"
 
@@ -34,6 +37,14 @@ namespace OpMon {
              */
             sf::Sprite sprite;
             bool fullScreen = false;
+            /*!
+             * \brief The textures used by snapshot(). A texture is free when the pool holds the only pointer to it.
+             */
+            std::vector<std::shared_ptr<sf::RenderTexture>> snapshots;
+            /*!
+             * \brief Measures the time since the last refresh() or idle().
+             */
+            sf::Clock frameClock;
 
           public:
             sf::RenderTexture &getFrame() { return frame; }
@@ -48,8 +59,14 @@ namespace OpMon {
             void open(Utils::OptionsSave &options);
             /*!
              * \brief Updates the Window::window with RenderTexture::frame
+             * \param overlay If not `nullptr`, drawn over the frame in the coordinates of the frame. It is only drawn on the window, so it never appears in the snapshots.
+             */
+            void refresh(sf::Drawable const *overlay = nullptr);
+            /*!
+             * \brief Waits until the end of the current frame without refreshing the window.
+             * \details Used instead of refresh() when nothing has been drawn, to keep the framerate without using the CPU or the graphics card.
              */
-            void refresh();
+            void idle();
             /*!
              * \brief Shortcut calling close() and open().
              */
@@ -58,8 +75,17 @@ namespace OpMon {
              * \brief Resizes Window::frame to fit with the size of Window::window.
              */
             void updateView();
+            /*!
+             * \brief Copies the current content of Window::frame in a texture of the snapshot pool.
+             * \details The copy is made by the graphics card, without reading the frame back to the memory. The texture returns to the pool when the last pointer to it is destroyed, so a snapshot must be kept as long as its texture is used.
+             */
+            std::shared_ptr<const sf::RenderTexture> snapshot();
             static int getBaseWindowWidth();
             static int getBaseWindowHeight();
+            /*!
+             * \brief The maximum number of frames per second.
+             */
+            static const unsigned int FRAMERATE = 30;
         };
     } // namespace Ui
 } // namespace OpMon
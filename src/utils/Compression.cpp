@@ -0,0 +1,155 @@
+/*
+Compression.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "Compression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Utils {
+    namespace Compression {
+
+        namespace {
+            constexpr std::size_t MIN_MATCH = 4;
+            constexpr std::size_t MAX_OFFSET = 0xFFFF;
+            constexpr unsigned int HASH_BITS = 12;
+
+            std::uint32_t read32(std::uint8_t const *data) {
+                std::uint32_t value;
+                std::memcpy(&value, data, sizeof(value));
+                return value;
+            }
+
+            void writeLength(std::vector<std::uint8_t> &out,
+                             std::size_t length) {
+                for(; length >= 255; length -= 255) {
+                    out.push_back(255);
+                }
+                out.push_back(length);
+            }
+
+            /*!
+             * \brief Writes a sequence. A `matchLength` of 0 means that the sequence is the last one.
+             */
+            void writeSequence(std::vector<std::uint8_t> &out,
+                               std::uint8_t const *literals,
+                               std::size_t literalCount, std::size_t offset,
+                               std::size_t matchLength) {
+                std::size_t matchCode =
+                    matchLength == 0 ? 0 : matchLength - MIN_MATCH;
+                out.push_back((std::min<std::size_t>(literalCount, 15) << 4) |
+                              std::min<std::size_t>(matchCode, 15));
+                if(literalCount >= 15) {
+                    writeLength(out, literalCount - 15);
+                }
+                out.insert(out.end(), literals, literals + literalCount);
+                if(matchLength == 0) {
+                    return;
+                }
+                out.push_back(offset & 0xFF);
+                out.push_back(offset >> 8);
+                if(matchCode >= 15) {
+                    writeLength(out, matchCode - 15);
+                }
+            }
+
+            bool readLength(std::vector<std::uint8_t> const &data,
+                            std::size_t &pos, std::size_t &length) {
+                std::uint8_t byte;
+                do {
+                    if(pos >= data.size()) {
+                        return false;
+                    }
+                    byte = data[pos++];
+                    length += byte;
+                } while(byte == 255);
+                return true;
+            }
+        } // namespace
+
+        std::vector<std::uint8_t>
+            compress(std::vector<std::uint8_t> const &data) {
+            std::vector<std::uint8_t> out;
+            out.reserve(data.size() / 2 + 16);
+            // Last position + 1 of each hashed 4-byte sequence, 0 if none
+            std::array<std::size_t, 1 << HASH_BITS> table {};
+            std::size_t anchor = 0;
+            std::size_t pos = 0;
+            while(pos + MIN_MATCH <= data.size()) {
+                std::uint32_t sequence = read32(&data[pos]);
+                std::size_t hash =
+                    (sequence * 2654435761u) >> (32 - HASH_BITS);
+                std::size_t candidate = table[hash];
+                table[hash] = pos + 1;
+                if(candidate == 0 || pos - (candidate - 1) > MAX_OFFSET ||
+                   read32(&data[candidate - 1]) != sequence) {
+                    pos++;
+                    continue;
+                }
+                std::size_t match = candidate - 1;
+                std::size_t length = MIN_MATCH;
+                while(pos + length < data.size() &&
+                      data[match + length] == data[pos + length]) {
+                    length++;
+                }
+                writeSequence(out, data.data() + anchor, pos - anchor,
+                              pos - match, length);
+                pos += length;
+                anchor = pos;
+            }
+            writeSequence(out, data.data() + anchor, data.size() - anchor, 0,
+                          0);
+            return out;
+        }
+
+        bool decompress(std::vector<std::uint8_t> const &data,
+                        std::size_t size, std::vector<std::uint8_t> &result) {
+            result.clear();
+            result.reserve(size);
+            std::size_t pos = 0;
+            while(pos < data.size()) {
+                std::uint8_t token = data[pos++];
+                std::size_t literalCount = token >> 4;
+                if(literalCount == 15 &&
+                   !readLength(data, pos, literalCount)) {
+                    return false;
+                }
+                if(literalCount > data.size() - pos ||
+                   result.size() + literalCount > size) {
+                    return false;
+                }
+                result.insert(result.end(), data.begin() + pos,
+                              data.begin() + pos + literalCount);
+                pos += literalCount;
+                if(pos == data.size()) {
+                    break; // Last sequence
+                }
+
+                if(data.size() - pos < 2) {
+                    return false;
+                }
+                std::size_t offset = data[pos] | (data[pos + 1] << 8);
+                pos += 2;
+                std::size_t length = token & 0x0F;
+                if(length == 15 && !readLength(data, pos, length)) {
+                    return false;
+                }
+                length += MIN_MATCH;
+                if(offset == 0 || offset > result.size() ||
+                   result.size() + length > size) {
+                    return false;
+                }
+                // The match can overlap the bytes it writes
+                std::size_t from = result.size() - offset;
+                for(std::size_t i = 0; i < length; i++) {
+                    result.push_back(result[from + i]);
+                }
+            }
+            return result.size() == size;
+        }
+
+    } // namespace Compression
+} // namespace Utils
@@ -0,0 +1,36 @@
+/*!
+ * \file Compression.hpp
+ * \brief Lossless compression of byte buffers.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Utils {
+    /*!
+     * \brief A small LZ77 compressor, used for the save files.
+     * \details The format is the one of the LZ4 blocks: a sequence starts with a token giving the number of literals and the length of the match, followed by the literals, the offset of the match (2 bytes, little-endian) and the extra bytes of the lengths. The last sequence has no match. It compresses well the repeated structures of the game data while being fast enough to stay unnoticed in a background thread.
+     */
+    namespace Compression {
+
+        /*!
+         * \brief Compresses a buffer.
+         */
+        std::vector<std::uint8_t> compress(std::vector<std::uint8_t> const &data);
+
+        /*!
+         * \brief Decompresses a buffer created by compress().
+         * \param data The compressed data.
+         * \param size The size of the uncompressed data.
+         * \param result Receives the uncompressed data.
+         * \returns `false` if the data is corrupted.
+         */
+        bool decompress(std::vector<std::uint8_t> const &data, std::size_t size,
+                        std::vector<std::uint8_t> &result);
+
+    } // namespace Compression
+} // namespace Utils
@@ -0,0 +1,225 @@
+/*
+FrameMetrics.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "FrameMetrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "../nlohmann/json.hpp"
+#include "log.hpp"
+
+namespace Utils {
+
+    namespace {
+        float elapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<float, std::milli>(
+                       std::chrono::steady_clock::now() - start)
+                .count();
+        }
+
+        nlohmann::json toJson(FrameMetrics::Stats const &stats) {
+            return {{"p50", stats.p50},
+                    {"p95", stats.p95},
+                    {"p99", stats.p99},
+                    {"max", stats.max},
+                    {"mean", stats.mean}};
+        }
+    } // namespace
+
+    FrameMetrics::Scope::Scope(Phase phase)
+        : phase(phase), start(std::chrono::steady_clock::now()) {}
+
+    FrameMetrics::Scope::~Scope() {
+        FrameMetrics::getInstance().addTime(phase, elapsedMilliseconds(start));
+    }
+
+    FrameMetrics::Series::Series(float bucketWidth, std::size_t bucketCount)
+        : buckets(bucketCount, 0), bucketWidth(bucketWidth) {}
+
+    void FrameMetrics::Series::add(float value) {
+        window[next] = value;
+        next = (next + 1) % WINDOW_SIZE;
+        filled = std::min(filled + 1, WINDOW_SIZE);
+
+        std::size_t bucket = std::min<std::size_t>(
+            std::max(value, 0.f) / bucketWidth, buckets.size() - 1);
+        buckets[bucket]++;
+        max = std::max(max, value);
+        sum += value;
+        count++;
+    }
+
+    FrameMetrics::Stats FrameMetrics::Series::getRecent() const {
+        Stats stats;
+        if(filled == 0) {
+            return stats;
+        }
+        std::array<float, WINDOW_SIZE> sorted;
+        std::copy(window.begin(), window.begin() + filled, sorted.begin());
+        std::sort(sorted.begin(), sorted.begin() + filled);
+        auto percentile = [&](float p) {
+            std::size_t rank = std::ceil(p * filled);
+            return sorted[std::max<std::size_t>(rank, 1) - 1];
+        };
+        stats.p50 = percentile(0.50);
+        stats.p95 = percentile(0.95);
+        stats.p99 = percentile(0.99);
+        stats.max = sorted[filled - 1];
+        double total = 0;
+        for(std::size_t i = 0; i < filled; i++) {
+            total += sorted[i];
+        }
+        stats.mean = total / filled;
+        return stats;
+    }
+
+    FrameMetrics::Stats FrameMetrics::Series::getSession() const {
+        Stats stats;
+        if(count == 0) {
+            return stats;
+        }
+        // The percentiles are given as the upper bound of their bucket
+        auto percentile = [&](float p) {
+            std::uint64_t rank =
+                std::max<std::uint64_t>(std::ceil(p * count), 1);
+            std::uint64_t seen = 0;
+            for(std::size_t i = 0; i < buckets.size(); i++) {
+                seen += buckets[i];
+                if(seen >= rank) {
+                    return std::min((i + 1) * bucketWidth, max);
+                }
+            }
+            return max;
+        };
+        stats.p50 = percentile(0.50);
+        stats.p95 = percentile(0.95);
+        stats.p99 = percentile(0.99);
+        stats.max = max;
+        stats.mean = sum / count;
+        return stats;
+    }
+
+    float FrameMetrics::Series::getRecentValue(std::size_t age) const {
+        return window[(next + WINDOW_SIZE - 1 - age) % WINDOW_SIZE];
+    }
+
+    FrameMetrics::FrameMetrics() {
+        // Times: buckets of 0.1 ms up to 100 ms
+        phases.assign(PHASE_COUNT, Series(0.1f, 1000));
+        // Counters: one bucket per value up to 1000
+        counters.assign(COUNTER_COUNT, Series(1.f, 1000));
+    }
+
+    FrameMetrics &FrameMetrics::getInstance() {
+        static FrameMetrics instance;
+        return instance;
+    }
+
+    void FrameMetrics::beginFrame() {
+        if(inFrame) {
+            endFrame();
+        }
+        currentTimes.fill(0);
+        currentCounts.fill(0);
+        frameStart = std::chrono::steady_clock::now();
+        inFrame = true;
+    }
+
+    void FrameMetrics::endFrame() {
+        if(!inFrame) {
+            return;
+        }
+        inFrame = false;
+        currentTimes[FRAME] = elapsedMilliseconds(frameStart);
+        currentTimes[UPDATE] =
+            std::max(currentTimes[UPDATE] - currentTimes[DRAW], 0.f);
+        for(std::size_t i = 0; i < PHASE_COUNT; i++) {
+            phases[i].add(currentTimes[i]);
+        }
+        for(std::size_t i = 0; i < COUNTER_COUNT; i++) {
+            counters[i].add(currentCounts[i]);
+        }
+        frameCount++;
+    }
+
+    void FrameMetrics::addTime(Phase phase, float milliseconds) {
+        currentTimes[phase] += milliseconds;
+    }
+
+    void FrameMetrics::addCount(Counter counter, unsigned int count) {
+        currentCounts[counter] += count;
+    }
+
+    FrameMetrics::Stats FrameMetrics::getRecent(Phase phase) const {
+        return phases[phase].getRecent();
+    }
+
+    FrameMetrics::Stats FrameMetrics::getRecent(Counter counter) const {
+        return counters[counter].getRecent();
+    }
+
+    const char *FrameMetrics::getName(Phase phase) {
+        static const char *names[] = {"events", "update", "draw", "refresh",
+                                      "frame"};
+        return names[phase];
+    }
+
+    const char *FrameMetrics::getName(Counter counter) {
+        static const char *names[] = {"overworld_draw_calls", "event_count"};
+        return names[counter];
+    }
+
+    void FrameMetrics::exportJson(std::string const &path) const {
+        nlohmann::json json;
+        json["frames"] = frameCount;
+        for(std::size_t i = 0; i < PHASE_COUNT; i++) {
+            const char *name = getName((Phase)i);
+            json["session"][name] = toJson(phases[i].getSession());
+            json["recent"][name] = toJson(phases[i].getRecent());
+        }
+        for(std::size_t i = 0; i < COUNTER_COUNT; i++) {
+            const char *name = getName((Counter)i);
+            json["session"][name] = toJson(counters[i].getSession());
+            json["recent"][name] = toJson(counters[i].getRecent());
+        }
+        std::ofstream file(path);
+        if(!file) {
+            Log::warn("Unable to write the frame metrics in " + path);
+            return;
+        }
+        file << json.dump(4) << std::endl;
+    }
+
+    void FrameMetrics::exportCsv(std::string const &path) const {
+        std::ofstream file(path);
+        if(!file) {
+            Log::warn("Unable to write the frame metrics in " + path);
+            return;
+        }
+        file << "frame";
+        for(std::size_t i = 0; i < PHASE_COUNT; i++) {
+            file << ',' << getName((Phase)i) << "_ms";
+        }
+        for(std::size_t i = 0; i < COUNTER_COUNT; i++) {
+            file << ',' << getName((Counter)i);
+        }
+        file << '\n';
+        std::size_t recent =
+            std::min<std::uint64_t>(frameCount, WINDOW_SIZE);
+        for(std::size_t age = recent; age-- > 0;) {
+            file << frameCount - 1 - age;
+            for(Series const &series : phases) {
+                file << ',' << series.getRecentValue(age);
+            }
+            for(Series const &series : counters) {
+                file << ',' << series.getRecentValue(age);
+            }
+            file << '\n';
+        }
+    }
+
+} // namespace Utils
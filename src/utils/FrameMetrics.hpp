@@ -0,0 +1,172 @@
+/*!
+ * \file FrameMetrics.hpp
+ * \brief Measures of the time spent in each part of a frame.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Utils {
+
+    /*!
+     * \brief Collects, for each frame, the time spent in each phase of the game loop and some counters.
+     * \details The values of the current frame are accumulated between beginFrame() and endFrame(). When the frame ends, they are added to two series per measure: a rolling window of the last frames, used for the in-game overlay, and a histogram of the whole session, exported at the end of the game.
+     *
+     * The UPDATE phase is measured around the update of the whole screen, which includes the DRAW phase: endFrame() removes the time spent drawing from it.
+     * \note This class is a singleton. It can only be acceded by using getInstance().
+     */
+    class FrameMetrics {
+      public:
+        /*!
+         * \brief The parts of a frame.
+         */
+        enum Phase { EVENTS, UPDATE, DRAW, REFRESH, FRAME, PHASE_COUNT };
+        /*!
+         * \brief The counters reset at each frame.
+         * \details SFML gives no way to count the draw calls of any screen, so OVERWORLD_DRAW_CALLS is only counted by the overworld, and is 0 on the other screens.
+         */
+        enum Counter { OVERWORLD_DRAW_CALLS, EVENT_COUNT, COUNTER_COUNT };
+
+        /*!
+         * \brief Statistics of a series of values.
+         */
+        struct Stats {
+            float p50 = 0;
+            float p95 = 0;
+            float p99 = 0;
+            float max = 0;
+            float mean = 0;
+        };
+
+        /*!
+         * \brief Measures the time between its construction and its destruction, and adds it to a phase of the current frame.
+         */
+        class Scope {
+          public:
+            explicit Scope(Phase phase);
+            ~Scope();
+            Scope(Scope const &) = delete;
+            Scope &operator=(Scope const &) = delete;
+
+          private:
+            Phase phase;
+            std::chrono::steady_clock::time_point start;
+        };
+
+        FrameMetrics(FrameMetrics const &) = delete;
+        void operator=(FrameMetrics const &) = delete;
+
+        static FrameMetrics &getInstance();
+
+        /*!
+         * \brief Starts a new frame.
+         */
+        void beginFrame();
+        /*!
+         * \brief Ends the current frame and saves its values.
+         */
+        void endFrame();
+
+        /*!
+         * \brief Adds a duration to a phase of the current frame.
+         * \param milliseconds The duration, in milliseconds.
+         */
+        void addTime(Phase phase, float milliseconds);
+        /*!
+         * \brief Adds a value to a counter of the current frame.
+         */
+        void addCount(Counter counter, unsigned int count = 1);
+
+        /*!
+         * \returns The statistics of the phase on the last frames.
+         */
+        Stats getRecent(Phase phase) const;
+        /*!
+         * \returns The statistics of the counter on the last frames.
+         */
+        Stats getRecent(Counter counter) const;
+
+        /*!
+         * \returns The number of frames measured since the beginning of the game.
+         */
+        std::uint64_t getFrameCount() const { return frameCount; }
+
+        static const char *getName(Phase phase);
+        static const char *getName(Counter counter);
+
+        /*!
+         * \brief Writes the statistics of the session and of the last frames in a JSON file.
+         */
+        void exportJson(std::string const &path) const;
+        /*!
+         * \brief Writes the values of each of the last frames in a CSV file.
+         */
+        void exportCsv(std::string const &path) const;
+
+      private:
+        FrameMetrics();
+
+        /*!
+         * \brief Number of frames kept in the rolling window.
+         */
+        static constexpr std::size_t WINDOW_SIZE = 256;
+
+        /*!
+         * \brief The values of a measure.
+         */
+        class Series {
+          public:
+            /*!
+             * \param bucketWidth The width of a bucket of the session histogram.
+             * \param bucketCount The number of buckets. Larger values are counted in the last bucket.
+             */
+            Series(float bucketWidth, std::size_t bucketCount);
+
+            void add(float value);
+            /*!
+             * \returns The statistics of the values in the rolling window.
+             */
+            Stats getRecent() const;
+            /*!
+             * \returns The statistics of the session. The percentiles are precise to a bucket width.
+             */
+            Stats getSession() const;
+            /*!
+             * \returns The value added `age` frames ago, 0 being the last value.
+             */
+            float getRecentValue(std::size_t age) const;
+
+          private:
+            std::array<float, WINDOW_SIZE> window {};
+            /*!
+             * \brief The index in the window where the next value is written.
+             */
+            std::size_t next = 0;
+            std::size_t filled = 0;
+
+            std::vector<std::uint32_t> buckets;
+            float bucketWidth;
+            float max = 0;
+            double sum = 0;
+            std::uint64_t count = 0;
+        };
+
+        std::vector<Series> phases;
+        std::vector<Series> counters;
+        /*!
+         * \brief The values of the current frame.
+         */
+        std::array<float, PHASE_COUNT> currentTimes {};
+        std::array<unsigned int, COUNTER_COUNT> currentCounts {};
+        std::chrono::steady_clock::time_point frameStart;
+        bool inFrame = false;
+        std::uint64_t frameCount = 0;
+    };
+
+} // namespace Utils
@@ -0,0 +1,110 @@
+/*!
+ * \file Id.hpp
+ * \brief Dense integer handles for string identifiers.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0 license
+ */
+#pragma once
+
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Utils {
+
+    /*!
+     * \brief A dense integer handle replacing a string identifier.
+     * \details Every string is interned once, when the data using it is loaded, and receives the next free index. The index can then be used directly to access a `std::vector`, so comparing or looking up handles never touches the string again. The handles of different kinds of resources are separated by the `Tag` type, so a map handle can't be given where a sound handle is expected.
+     *
+     * The names are kept for as long as the program runs, so the indexes stay the same when the data is reloaded.
+     * \tparam Tag An empty type identifying the kind of resource.
+     */
+    template <typename Tag> class Id {
+      public:
+        /*!
+         * \brief The index of a handle which doesn't refer to anything.
+         */
+        static constexpr unsigned int INVALID =
+            std::numeric_limits<unsigned int>::max();
+
+        /*!
+         * \brief Creates an invalid handle.
+         */
+        constexpr Id() = default;
+
+        /*!
+         * \brief Returns the handle associated with a name, creating it if needed.
+         * \details Must be used by the code loading the resources.
+         */
+        static Id intern(std::string const &name) {
+            Registry &reg = registry();
+            auto found = reg.indexes.find(name);
+            if(found != reg.indexes.end()) {
+                return Id(found->second);
+            }
+            unsigned int index = reg.names.size();
+            reg.names.push_back(name);
+            reg.indexes.emplace(name, index);
+            return Id(index);
+        }
+
+        /*!
+         * \brief Returns the handle associated with a name.
+         * \returns The handle, or an invalid handle if the name has never been interned.
+         */
+        static Id find(std::string const &name) {
+            Registry const &reg = registry();
+            auto found = reg.indexes.find(name);
+            return found != reg.indexes.end() ? Id(found->second) : Id();
+        }
+
+        /*!
+         * \brief Returns the number of handles created so far.
+         * \details Can be used to size a vector indexed by the handles.
+         */
+        static unsigned int count() { return registry().names.size(); }
+
+        /*!
+         * \brief Returns the handle with the given index, to iterate over all the handles.
+         * \returns The handle, or an invalid handle if `index` is not lower than count().
+         */
+        static Id fromIndex(unsigned int index) {
+            return index < count() ? Id(index) : Id();
+        }
+
+        /*!
+         * \brief Returns the name the handle has been created from.
+         */
+        std::string const &getName() const {
+            static const std::string invalidName = "<invalid>";
+            return isValid() ? registry().names[index] : invalidName;
+        }
+
+        constexpr unsigned int getIndex() const { return index; }
+        constexpr bool isValid() const { return index != INVALID; }
+
+        constexpr bool operator==(Id const &other) const {
+            return index == other.index;
+        }
+        constexpr bool operator!=(Id const &other) const {
+            return index != other.index;
+        }
+
+      private:
+        constexpr explicit Id(unsigned int index): index(index) {}
+
+        struct Registry {
+            std::unordered_map<std::string, unsigned int> indexes;
+            std::vector<std::string> names;
+        };
+
+        static Registry &registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        unsigned int index = INVALID;
+    };
+
+} // namespace Utils
@@ -0,0 +1,41 @@
+/*!
+ * \file LoadingProgress.hpp
+ * \brief Progress of a loading made in another thread.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+
+namespace Utils {
+    /*!
+     * \brief Counts the steps done by a loading, to show its progress while it runs in another thread.
+     * \details The loading thread adds the number of steps it will do with addSteps(), then calls advance() after each one. The counters are atomic, so getRatio() can be called from any thread.
+     */
+    class LoadingProgress {
+      public:
+        /*!
+         * \brief Adds steps to the loading.
+         */
+        void addSteps(unsigned int count) { total += count; }
+
+        /*!
+         * \brief Marks one step as done.
+         */
+        void advance() { done++; }
+
+        /*!
+         * \returns The part of the steps already done, between 0 and 1.
+         */
+        float getRatio() const {
+            unsigned int steps = total;
+            return steps == 0 ? 0.f : std::min(1.f, (float)done / steps);
+        }
+
+      private:
+        std::atomic<unsigned int> done {0};
+        std::atomic<unsigned int> total {0};
+    };
+} // namespace Utils
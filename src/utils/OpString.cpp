@@ -9,18 +9,19 @@ File under GNU GPL v3.0 license
 #include <algorithm>
 #include <cstddef>
 #include <iostream>
+#include <utility>
 
 #include "./log.hpp"
 
 namespace Utils {
 
     OpString::OpString(StringKeys &instance, std::string const &key,
-                       std::vector<sf::String *> obj) {
-        this->key = key;
-        unsigned int instances = (key == "void") ? 0 :
-                                                   StringKeys::countInstances(
-                                                       instance.get(key), '~');
-        this->objects = obj;
+                       std::vector<const sf::String *> obj)
+        : key(key), objects(std::move(obj)) {
+        unsigned int instances = 0;
+        if(key != "void" && getIndex(instance) != -1) {
+            instances = instance.getTemplate(index).getSlotCount();
+        }
 
         if(objects.size() != instances) {
             Log::warn("OpString: number of '~' placeholders and arguments "
@@ -31,49 +32,57 @@ namespace Utils {
 
     OpString::OpString() {}
 
-    sf::String OpString::quickString(StringKeys &instance,
-                                     std::string const &key,
-                                     std::vector<std::string> vstr) {
-        std::vector<sf::String *> vect;
-        for(std::string str : vstr) {
-            vect.push_back(new sf::String(str));
+    int OpString::getIndex(StringKeys &instance) const {
+        if(generation != instance.getGeneration()) {
+            index = instance.getIndex(key);
+            generation = instance.getGeneration();
         }
-        OpString op = OpString(instance, key, vect);
-        sf::String str = op.getString(instance);
+        return index;
+    }
 
-        for(sf::String *sfstr : vect) {
-            delete(sfstr);
+    sf::String OpString::quickString(StringKeys &instance,
+                                     std::string const &key,
+                                     std::initializer_list<sf::String> vstr) {
+        int index = instance.getIndex(key);
+        if(index == -1) {
+            return instance.get(key); // Warns and returns the void string
         }
-
+        sf::String str;
+        instance.getTemplate(index).format(vstr, str);
         return str;
     }
 
     sf::String OpString::getString(StringKeys &instance) const {
+        sf::String toReturn;
+        getString(instance, toReturn);
+        return toReturn;
+    }
+
+    void OpString::getString(StringKeys &instance, sf::String &out) const {
         if(this->key.empty() ||
            this->key == "void") { // If empty or void, it doesn't execute the
                                   // algorithm. That would be useless.
-            return sf::String();
+            out.clear();
+            return;
         }
-        if(objects.size() ==
-           0) { // If there is not object, it just returns the string.
-            return instance.get(key);
+        if(getIndex(instance) == -1) {
+            out = instance.get(key); // Warns and returns the void string
+            return;
         }
-        // Ok, so there is some things to do
-        std::vector<sf::String> splitted =
-            StringKeys::split(instance.get(key), '~'); // Split every ~
+        instance.getTemplate(index).format(objects, out);
+    }
 
-        sf::String toReturn;
-        for(size_t i = 0; i < splitted.size(); ++i) {
-            toReturn += splitted[i];
-            if(i < objects.size()) {
-                toReturn += *objects[i];
-            } else if(i != splitted.size() - 1) {
-                // This case only happens when there isn't enough objects to
-                // fill all placeholders.
-                toReturn += '~';
-            }
+    void OpString::getString(StringKeys &instance,
+                             std::basic_string<sf::Uint32> &out) const {
+        if(this->key.empty() || this->key == "void") {
+            out.clear();
+            return;
         }
-
-        return toReturn;
+        if(getIndex(instance) == -1) {
+            sf::String str = instance.get(key); // Warns
+            out.assign(str.getData(), str.getSize());
+            return;
+        }
+        instance.getTemplate(index).format(objects, out);
     }
 } // namespace Utils
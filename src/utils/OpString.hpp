@@ -10,6 +10,7 @@
 #ifndef OPSTRING_PROTECTED
 #define OPSTRING_PROTECTED
 #include <SFML/System/String.hpp>
+#include <initializer_list>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -24,7 +25,9 @@ namespace Utils {
     /*!
      * \class OpString OpString.hpp "utils/OpString.hpp"
      * \brief A string with an empty space to complete using StringKeys.
-     * \details Every `~` in the character string will be completed by the given array of objects, one by one. If there isn't enough objects, the `~` will be deleted from the string, and if there is too much objects, they will only be ignored.
+     * \details Every `~` in the character string will be completed by the given array of objects, one by one. If there isn't enough objects, the `~` will be kept in the string, and if there is too much objects, they will only be ignored.
+     *
+     * The string is used through its StringTemplate, so it is not parsed again each time the OpString is completed. The index of the template is cached and only looked up again when another language is loaded.
      * \todo Rename for a clearer name and not OpMon-related.
      */
     class OpString {
@@ -37,7 +40,21 @@ namespace Utils {
          * \brief The vector of objects to insert in the string.
          * \details It's a pointer because it allows the value to change after the initialisation of the object.
          */
-        std::vector<sf::String *> objects;
+        std::vector<const sf::String *> objects;
+
+        /*!
+         * \brief The generation of the StringKeys instance in which OpString::index has been found.
+         */
+        mutable unsigned int generation = 0;
+        /*!
+         * \brief The cached index of the key, or -1 if it has not been found.
+         */
+        mutable int index = -1;
+
+        /*!
+         * \brief Returns the index of the key in the given instance, updating the cache if needed.
+         */
+        int getIndex(StringKeys &instance) const;
 
       public:
         /*!
@@ -46,7 +63,7 @@ namespace Utils {
          * \param obj A array of pointers to objects completing the string.
          */
         OpString(StringKeys &instance, std::string const &key,
-                 std::vector<sf::String *> obj = {});
+                 std::vector<const sf::String *> obj = {});
         /*!
          * \brief Contructs an empty OpString with no key nor object.
          * \details It is not possible to set the key and the objects after. However, it is still possible to call getString(), which will return an empty string.
@@ -60,6 +77,10 @@ namespace Utils {
         const sf::String &getObject(int index) const {
             return *(objects[index]);
         }
+        /*!
+         * \returns The number of objects completing the string.
+         */
+        std::size_t getObjectCount() const { return objects.size(); }
         /*!
          * \returns The key giving the string in StringKeys.
          */
@@ -69,16 +90,29 @@ namespace Utils {
          * \returns The completed string.
          */
         sf::String getString(StringKeys &instance) const;
+        /*!
+         * \brief Generates the completed string into the given string.
+         * \details Allows to reuse the memory of a string completed again and again.
+         * \param out The string receiving the result.
+         */
+        void getString(StringKeys &instance, sf::String &out) const;
+        /*!
+         * \brief Generates the completed string into the given UTF-32 buffer.
+         * \details Unlike with a sf::String, completing the string again and again into the same buffer doesn't allocate.
+         * \param out The buffer receiving the result.
+         */
+        void getString(StringKeys &instance,
+                       std::basic_string<sf::Uint32> &out) const;
 
         /*!
          * \brief Creates an OpString and directly returns the result of getString().
-         * \details It's a quicker version to have a string because it uses std::string instead of sf::String pointers.
+         * \details It's a quicker version to have a string because it takes the objects directly instead of sf::String pointers.
          * \param key The key allowing to get the character string from StringKeys.
-         * \param vstr The array of objects completing the string.
+         * \param vstr The objects completing the string.
          */
-        static sf::String quickString(StringKeys &instance,
-                                      std::string const &key,
-                                      std::vector<std::string> vstr = {});
+        static sf::String
+        quickString(StringKeys &instance, std::string const &key,
+                    std::initializer_list<sf::String> vstr = {});
     };
 
 } // namespace Utils
@@ -6,120 +6,257 @@
 */
 #include "OptionsSave.hpp"
 
-#include <SFML/System/String.hpp>
-#include <algorithm>
-#include <cstddef>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
-#include <memory>
 
-#include "StringKeys.hpp"
 #include "log.hpp"
 
 namespace Utils {
 
-    Param::Param(std::string name, std::string value) {
-        this->paramName = name;
-        this->value = value;
+    namespace {
+        /*!
+         * \brief Reads a value written in the file, guessing its type.
+         */
+        OptionsSave::Value parseValue(std::string const &text) {
+            if(text == "true" || text == "false") {
+                return text == "true";
+            }
+            int integer = 0;
+            auto [end, error] =
+                std::from_chars(text.data(), text.data() + text.size(), integer);
+            if(!text.empty() && error == std::errc() &&
+               end == text.data() + text.size()) {
+                return integer;
+            }
+            char *floatEnd = nullptr;
+            float decimal = std::strtof(text.c_str(), &floatEnd);
+            if(!text.empty() && floatEnd == text.c_str() + text.size()) {
+                return decimal;
+            }
+            return text;
+        }
+
+        std::string toString(OptionsSave::Value const &value) {
+            if(auto boolean = std::get_if<bool>(&value)) {
+                return *boolean ? "true" : "false";
+            } else if(auto integer = std::get_if<int>(&value)) {
+                return std::to_string(*integer);
+            } else if(auto decimal = std::get_if<float>(&value)) {
+                return std::to_string(*decimal);
+            }
+            return std::get<std::string>(value);
+        }
+    } // namespace
+
+    OptionsSave::OptionsSave(std::string const &file): file(file) {
+        Utils::Log::oplog("Loading of the settings.");
+        std::ifstream stream(file);
+        if(!stream) {
+            Log::warn("Unable to open the settings file. If the file was only "
+                      "non-existent, it will be created.");
+        }
+        std::string line;
+        while(std::getline(stream, line)) {
+            // Checks if the pm| prefix is present, if not, stop the loop.
+            if(line.compare(0, 3, "pm|") != 0) {
+                break;
+            }
+            std::size_t equals = line.find('=', 3);
+            if(equals == std::string::npos) {
+                continue;
+            }
+            values.emplace(line.substr(3, equals - 3),
+                           parseValue(line.substr(equals + 1)));
+        }
+        thread = std::thread(&OptionsSave::run, this);
+    }
+
+    OptionsSave::~OptionsSave() {
+        flush();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        thread.join();
     }
 
-    std::string Param::getName() const { return this->paramName; }
+    bool OptionsSave::checkParam(std::string const &name) const {
+        return values.count(name) != 0;
+    }
 
-    std::string Param::getValue() const { return this->value; }
+    int OptionsSave::getInt(std::string const &name, int fallback) const {
+        auto found = values.find(name);
+        if(found == values.end()) {
+            return fallback;
+        }
+        Value const &value = found->second;
+        if(auto integer = std::get_if<int>(&value)) {
+            return *integer;
+        } else if(auto decimal = std::get_if<float>(&value)) {
+            return (int)*decimal;
+        } else if(auto boolean = std::get_if<bool>(&value)) {
+            return *boolean;
+        }
+        return fallback;
+    }
 
-    void Param::setValue(std::string value) { this->value = value; }
+    float OptionsSave::getFloat(std::string const &name, float fallback) const {
+        auto found = values.find(name);
+        if(found == values.end()) {
+            return fallback;
+        }
+        Value const &value = found->second;
+        if(auto decimal = std::get_if<float>(&value)) {
+            return *decimal;
+        } else if(auto integer = std::get_if<int>(&value)) {
+            return *integer;
+        }
+        return fallback;
+    }
 
-    Param OptionsSave::getParam(std::string const &name) {
-        if(searchParam(name) != -1) {
-            return paramList[searchParam(name)];
-        } else {
-            return Param("NULL", "NULL");
+    bool OptionsSave::getBool(std::string const &name, bool fallback) const {
+        auto found = values.find(name);
+        if(found == values.end()) {
+            return fallback;
+        }
+        Value const &value = found->second;
+        if(auto boolean = std::get_if<bool>(&value)) {
+            return *boolean;
+        } else if(auto integer = std::get_if<int>(&value)) {
+            return *integer != 0;
         }
+        return fallback;
+    }
+
+    std::string OptionsSave::getString(std::string const &name,
+                                       std::string const &fallback) const {
+        auto found = values.find(name);
+        return found != values.end() ? toString(found->second) : fallback;
     }
 
-    void OptionsSave::addOrModifParam(std::string const &name,
-                                      std::string const &value) {
-        if(searchParam(name) == -1) { // Add Param (No Exist)
-            paramList.push_back(Param(name, value));
-        } else { // Param Exist
-            paramList[searchParam(name)].setValue(value);
+    void OptionsSave::set(std::string const &name, Value value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = values.find(name);
+            if(found != values.end() && found->second == value) {
+                return;
+            }
+            values[name] = std::move(value);
         }
+        changed(name);
     }
 
-    Param OptionsSave::deleteParam(std::string const &name) {
-        if(searchParam(name) == -1) {
-            return Param("NULL", "NULL");
-        } else {
-            Param toReturn = paramList[searchParam(name)];
-            paramList.erase(paramList.begin() + searchParam(name));
-            return toReturn;
+    void OptionsSave::setDefault(std::string const &name, Value value) {
+        if(!checkParam(name)) {
+            set(name, std::move(value));
         }
     }
 
-    int OptionsSave::searchParam(std::string const &name) {
-        for(size_t i = 0; i < paramList.size(); ++i) {
-            if(paramList[i].getName() == name) {
-                return i;
+    bool OptionsSave::deleteParam(std::string const &name) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(values.erase(name) == 0) {
+                return false;
             }
         }
-        return -1;
+        changed(name);
+        return true;
     }
 
-    OptionsSave::OptionsSave(std::string const &file): file(file) {
-        Utils::Log::oplog("Loading of the settings.");
-        std::ifstream stream(file.c_str());
-        if(!stream) { // If the file doesn't exist, it is created and opened
-                      // when saving the parameters
-            std::ofstream strm(file.c_str());
-            strm.close();
-            std::ifstream cpy(file.c_str());
-            Log::warn("Unable to open the settings file. If the file was only "
-                      "non-existent, it was created. It will therefore be "
-                      "opened correctly when rebooting.");
-        }
-        std::string read;
-        int i = 0;
-        while(!stream.eof()) {
-            getline(stream, read);
-            if(!(read.substr(0, read.size() - (read.size() - 3)) ==
-                 "pm|")) { // Checks if the pm| prefix is present, if not, stop
-                           // the loop.
-                break;
+    unsigned int OptionsSave::addListener(std::string const &name,
+                                          Listener listener) {
+        listeners[name].push_back({nextListenerId, std::move(listener)});
+        return nextListenerId++;
+    }
+
+    void OptionsSave::removeListener(unsigned int id) {
+        for(auto &[name, listening] : listeners) {
+            for(auto itor = listening.begin(); itor != listening.end(); ++itor) {
+                if(itor->id == id) {
+                    listening.erase(itor);
+                    return;
+                }
             }
-            std::string noPm =
-                Utils::StringKeys::sfStringtoStdString(Utils::StringKeys::split(
-                    read, '|')[1]); // Only takes the part after the pm|
-            std::vector<sf::String> splitted =
-                Utils::StringKeys::split(noPm, '=');
-            Param newParam =
-                Param(Utils::StringKeys::sfStringtoStdString(splitted[0]),
-                      Utils::StringKeys::sfStringtoStdString(
-                          splitted[1])); // Splits the string in two parts : the
-                                         // name and the value of the parameter
-            if(!checkParam(newParam.getName())) {
-                paramList.push_back(newParam);
+        }
+    }
+
+    void OptionsSave::changed(std::string const &name) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            dirty = true;
+            saveTime = std::chrono::steady_clock::now() + SAVE_DELAY;
+        }
+        condition.notify_all();
+
+        auto found = listeners.find(name);
+        if(found != listeners.end()) {
+            // Copied, since a listener can add or remove listeners
+            std::vector<Listening> toCall = found->second;
+            for(Listening const &listening : toCall) {
+                listening.listener(name);
             }
         }
+    }
 
-        stream.close();
+    void OptionsSave::flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        if(dirty) {
+            saveTime = std::chrono::steady_clock::now();
+            condition.notify_all();
+        }
+        condition.wait(lock, [this] { return !dirty && !writing; });
     }
 
-    void OptionsSave::saveParams() {
-        std::ofstream stream(file.c_str());
-        std::string toGo;
-        for(Param &currentObj : paramList) {
-            toGo +=
-                ("pm|" + currentObj.getName() + "=" + currentObj.getValue() +
-                 '\n'); // Adds the pm| and writes the parameter into the file
-            stream << toGo;
-            toGo = std::string("");
+    void OptionsSave::run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true) {
+            condition.wait(lock, [this] { return stopping || dirty; });
+            if(!dirty) {
+                return;
+            }
+            // Waits until the options haven't changed for SAVE_DELAY
+            while(!stopping && std::chrono::steady_clock::now() < saveTime) {
+                condition.wait_until(lock, saveTime);
+            }
+            std::string content = serialize();
+            dirty = false;
+            writing = true;
+            lock.unlock();
+            if(!writeFile(content)) {
+                Log::warn("Unable to save the settings in " + file);
+            }
+            lock.lock();
+            writing = false;
+            condition.notify_all();
         }
-        stream.close();
     }
 
-    bool OptionsSave::checkParam(std::string const &name) {
-        return searchParam(name) != -1;
+    std::string OptionsSave::serialize() const {
+        std::string content;
+        for(auto const &[name, value] : values) {
+            content += "pm|" + name + "=" + toString(value) + '\n';
+        }
+        return content;
     }
 
-    OptionsSave::~OptionsSave() { saveParams(); }
+    bool OptionsSave::writeFile(std::string const &content) const {
+        std::string temporary = file + ".tmp";
+        {
+            std::ofstream stream(temporary, std::ios::trunc);
+            stream << content;
+            stream.flush();
+            if(!stream) {
+                return false;
+            }
+        }
+        // Replaces the previous file only once the new one is complete
+        std::error_code error;
+        std::filesystem::rename(temporary, file, error);
+        return !error;
+    }
 
 } // namespace Utils
@@ -7,101 +7,168 @@
 #ifndef OPTIONSSAVE_HPP
 #define OPTIONSSAVE_HPP
 
-#include <fstream>
-#include <sstream>
-
-#include "StringKeys.hpp"
-
-/*!
- * \brief Macro used to explicit the use of OptionsSave::addOrModifParam when calling it in the code.
- */
-#define addParam addOrModifParam
-/*!
- *\brief Macro used to explicit the use of OptionsSave::addOrModifParam when calling it in the code.
- */
-#define editParam addOrModifParam
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
 namespace Utils {
-    /**
-     * \brief Defines a parameter.
-     */
-    class Param {
-      private:
-        std::string paramName;
-        std::string value;
-
-      public:
-        /*!
-         * \param name The parameter's name. Alphanumeric characters only.
-         * \param value The parameter's value.
-         */
-        Param(std::string name, std::string value);
-        std::string getName() const;
-        std::string getValue() const;
-        void setValue(std::string value);
-    };
 
     /*!
-     *	\brief Contains the functions used to save the parameters.
-     *  \todo Save the parameters in JSON.
+     * \brief Stores the options of the game and saves them in a file.
+     * \details The options are typed values (integer, float, boolean or string) stored by name in a hash map. The getters convert the value if it has another type, and return a default value if the option doesn't exist.
+     *
+     * Setting an option doesn't write the file: the writing is delayed by SAVE_DELAY, and done by a background thread. Several changes made in a short time, like pressing the volume key several times, are written only once. The file is written next to the previous one, then renamed over it, so it is never left half-written.
+     *
+     * Code depending on an option registers a listener with addListener(), which is called each time the option changes. This way, the Jukebox or the options menu don't have to check the options every frame.
+     *
+     * The file contains one option per line, with the format `pm|name=value`.
+     * \note The options must only be read and modified by the main thread.
      */
     class OptionsSave {
       public:
+        using Value = std::variant<bool, int, float, std::string>;
         /*!
-         * \returns The parameter with this name in OptionsSave::paramList. Returns an empty parameter if none exists with the given name.
-         * \param name The name of the parameter.
+         * \brief A function called when an option changes, with the name of the option.
          */
-        Param getParam(std::string const &name);
+        using Listener = std::function<void(std::string const &)>;
 
         /*!
-         * \brief Sets the parameter with the given name to the given value.
-         * \details If the parameters doesn't exist yet, it will be created.
-         * \param name The name of the parameter.
-         * \param value The value to set the parameter to.
-         * \todo Change to addOrEditParam
+         * \brief The delay between the last change of an option and the writing of the file.
          */
-        void addOrModifParam(std::string const &name, std::string const &value);
+        static constexpr std::chrono::milliseconds SAVE_DELAY {500};
 
         /*!
-         * \brief Deletes a parameter.
-         * \param name The name of the parameter.
-         * \returns The deleted parameter. If none exists with this name, returns an empty parameter.
+         * \brief Loads the options.
+         * \param file The file in which the options are stored.
          */
-        Param deleteParam(std::string const &name);
+        OptionsSave(std::string const &file);
+        OptionsSave(OptionsSave const &) = delete;
+        OptionsSave &operator=(OptionsSave const &) = delete;
 
         /*!
-         * \brief Saves the parameters.
+         * \brief Writes the options if they have changed since the last writing, and stops the writing thread.
          */
-        void saveParams();
+        ~OptionsSave();
 
         /*!
-         * \brief Loads the paramters.
-         * \param file The file in which the parameters are stored.
+         * \brief Checks if an option exists.
          */
-        OptionsSave(std::string const &file);
+        bool checkParam(std::string const &name) const;
+
+        /*!
+         * \returns The value of an option, or `fallback` if the option doesn't exist or can't be converted to an integer.
+         */
+        int getInt(std::string const &name, int fallback = 0) const;
+        /*!
+         * \copydoc getInt
+         */
+        float getFloat(std::string const &name, float fallback = 0) const;
+        /*!
+         * \copydoc getInt
+         */
+        bool getBool(std::string const &name, bool fallback = false) const;
+        /*!
+         * \returns The value of an option converted to a string, or `fallback` if the option doesn't exist.
+         */
+        std::string getString(std::string const &name,
+                              std::string const &fallback = "") const;
 
         /*!
-         * \brief Checks if a parameters exists.
-         * \param name The name of the parameter.
-         * \returns `true` if the parameters exists, `false` otherwise.
+         * \brief Sets an option, creating it if needed.
+         * \details If the value changes, the listeners of the option are called and the file will be written after SAVE_DELAY.
          */
-        bool checkParam(std::string const &name);
+        void set(std::string const &name, Value value);
+        void set(std::string const &name, const char *value) {
+            set(name, Value(std::string(value)));
+        }
 
-        ~OptionsSave();
+        /*!
+         * \brief Sets an option only if it doesn't exist yet.
+         */
+        void setDefault(std::string const &name, Value value);
+
+        /*!
+         * \brief Deletes an option.
+         * \returns `false` if the option didn't exist.
+         */
+        bool deleteParam(std::string const &name);
+
+        /*!
+         * \brief Registers a function called each time an option changes.
+         * \details The listeners of an option are called in the order they have been registered, right after the option has been changed.
+         * \returns An identifier to give to removeListener().
+         */
+        unsigned int addListener(std::string const &name, Listener listener);
+
+        /*!
+         * \brief Removes a listener registered with addListener().
+         */
+        void removeListener(unsigned int id);
+
+        /*!
+         * \brief Writes the options now if they have changed, and waits until they are written.
+         */
+        void flush();
 
       private:
         /*!
-         * \brief The list of the different parameters.
-         * \todo Change this to an std::list ?
+         * \brief The loop of the writing thread.
+         */
+        void run();
+
+        /*!
+         * \brief Converts the options to the content of the file. The mutex must be locked.
          */
-        std::vector<Param> paramList;
+        std::string serialize() const;
+
+        /*!
+         * \brief Writes the content of the file.
+         * \returns `false` if the file couldn't be written.
+         */
+        bool writeFile(std::string const &content) const;
+
+        void changed(std::string const &name);
+
+        std::unordered_map<std::string, Value> values;
+
+        struct Listening {
+            unsigned int id;
+            Listener listener;
+        };
+        std::unordered_map<std::string, std::vector<Listening>> listeners;
+        unsigned int nextListenerId = 0;
 
         /*!
          * \brief The file used to save the options.
          */
         std::string file;
 
-        int searchParam(std::string const &name);
+        /*!
+         * \brief Protects `values` from the writing thread, and the fields below.
+         * \details The main thread only locks it when it modifies `values`, since it is the only one modifying them.
+         */
+        mutable std::mutex mutex;
+        std::condition_variable condition;
+        /*!
+         * \brief `true` if the options have changed since the last writing.
+         */
+        bool dirty = false;
+        /*!
+         * \brief `true` while the writing thread writes the file.
+         */
+        bool writing = false;
+        bool stopping = false;
+        /*!
+         * \brief When the file has to be written.
+         */
+        std::chrono::steady_clock::time_point saveTime;
+        std::thread thread;
     };
 } // namespace Utils
 #endif // OPTIONSSAVE_HPP
@@ -0,0 +1,158 @@
+/*
+Profiler.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "log.hpp"
+
+namespace Utils {
+    namespace Profiler {
+
+        namespace {
+            /*!
+             * \brief Number of zones kept per thread.
+             */
+            constexpr std::size_t ZONE_CAPACITY = 1 << 16;
+
+            struct ZoneRecord {
+                const char *name;
+                std::uint64_t start;
+                std::uint64_t end;
+            };
+
+            /*!
+             * \brief The zones of a thread.
+             * \details The mutex is only shared with dump(), so it is never contended while the game runs.
+             */
+            struct ThreadBuffer {
+                std::mutex mutex;
+                std::vector<ZoneRecord> zones =
+                    std::vector<ZoneRecord>(ZONE_CAPACITY);
+                std::size_t next = 0;
+                bool full = false;
+                unsigned int threadId = 0;
+            };
+
+            struct Registry {
+                std::mutex mutex;
+                /*!
+                 * \brief The buffers of all the threads. They are kept after the end of their thread, to be dumped.
+                 */
+                std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+                /*!
+                 * \brief The beginnings of the last frames, as a ring buffer.
+                 */
+                std::array<std::uint64_t, FRAME_COUNT> frameStarts {};
+                std::size_t frames = 0;
+            };
+
+            Registry &getRegistry() {
+                static Registry registry;
+                return registry;
+            }
+
+            ThreadBuffer &getThreadBuffer() {
+                thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+                    auto created = std::make_shared<ThreadBuffer>();
+                    Registry &registry = getRegistry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    created->threadId = registry.buffers.size();
+                    registry.buffers.push_back(created);
+                    return created;
+                }();
+                return *buffer;
+            }
+        } // namespace
+
+        std::uint64_t now() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        void addZone(const char *name, std::uint64_t start,
+                     std::uint64_t end) {
+            ThreadBuffer &buffer = getThreadBuffer();
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+            buffer.zones[buffer.next] = {name, start, end};
+            buffer.next = (buffer.next + 1) % ZONE_CAPACITY;
+            buffer.full = buffer.full || buffer.next == 0;
+        }
+
+        void newFrame() {
+            Registry &registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.frameStarts[registry.frames % FRAME_COUNT] = now();
+            registry.frames++;
+        }
+
+        bool dump(std::string const &path) {
+#ifndef OPMON_PROFILER
+            (void)path;
+            Log::warn("The profiler is disabled. Compile with OPMON_PROFILER "
+                      "to record a trace.");
+            return false;
+#else
+            Registry &registry = getRegistry();
+            std::vector<std::pair<unsigned int, ZoneRecord>> zones;
+            std::uint64_t since = 0;
+            {
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                if(registry.frames > FRAME_COUNT) {
+                    since =
+                        registry.frameStarts[registry.frames % FRAME_COUNT];
+                }
+                for(auto const &buffer : registry.buffers) {
+                    std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                    std::size_t count =
+                        buffer->full ? ZONE_CAPACITY : buffer->next;
+                    for(std::size_t i = 0; i < count; i++) {
+                        ZoneRecord const &zone = buffer->zones[i];
+                        if(zone.start >= since) {
+                            zones.emplace_back(buffer->threadId, zone);
+                        }
+                    }
+                }
+            }
+
+            std::ofstream file(path);
+            if(!file) {
+                Log::warn("Unable to write the profiler trace in " + path);
+                return false;
+            }
+            std::uint64_t origin = UINT64_MAX;
+            for(auto const &zone : zones) {
+                origin = std::min(origin, zone.second.start);
+            }
+            // Chrome trace format, with times in microseconds
+            file << std::fixed << std::setprecision(3);
+            file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            bool first = true;
+            for(auto const &[threadId, zone] : zones) {
+                file << (first ? "\n" : ",\n") << "{\"name\":\"" << zone.name
+                     << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId
+                     << ",\"ts\":" << (zone.start - origin) / 1000.0
+                     << ",\"dur\":" << (zone.end - zone.start) / 1000.0
+                     << "}";
+                first = false;
+            }
+            file << "\n]}\n";
+            Log::oplog("Profiler trace written in " + path + " (" +
+                       std::to_string(zones.size()) + " zones)");
+            return true;
+#endif
+        }
+
+    } // namespace Profiler
+} // namespace Utils
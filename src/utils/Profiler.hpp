@@ -0,0 +1,84 @@
+/*!
+ * \file Profiler.hpp
+ * \brief Instrumentation profiler recording nested zones over the last frames.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#ifdef OPMON_PROFILER
+#    define OPMON_PROFILE_CONCAT2(a, b) a##b
+#    define OPMON_PROFILE_CONCAT(a, b) OPMON_PROFILE_CONCAT2(a, b)
+/*!
+ * \brief Measures the time until the end of the current block as a zone named `name`.
+ * \details `name` must be a string literal, or at least live until the end of the program. Compiled out if OPMON_PROFILER isn't defined.
+ */
+#    define OPMON_PROFILE_ZONE(name)                                         \
+        Utils::Profiler::Zone OPMON_PROFILE_CONCAT(profilerZone, __LINE__)( \
+            name)
+/*!
+ * \brief Marks the beginning of a frame. Compiled out if OPMON_PROFILER isn't defined.
+ */
+#    define OPMON_PROFILE_FRAME() Utils::Profiler::newFrame()
+#else
+#    define OPMON_PROFILE_ZONE(name) (void)0
+#    define OPMON_PROFILE_FRAME() (void)0
+#endif
+
+namespace Utils {
+
+    /*!
+     * \brief Records the zones declared with OPMON_PROFILE_ZONE.
+     * \details Each thread writes its zones in its own ring buffer, so that profiling doesn't add contention between threads. The beginnings of the last frames are kept, and dump() writes the zones of these frames in the Chrome trace format, which can be opened with `chrome://tracing` or Perfetto to see the zones as a timeline.
+     *
+     * The profiler is only active if the game is compiled with OPMON_PROFILER defined (CMake option of the same name).
+     */
+    namespace Profiler {
+
+        /*!
+         * \brief Number of frames written by dump().
+         */
+        constexpr unsigned int FRAME_COUNT = 120;
+
+        /*!
+         * \returns The current time in nanoseconds, from an arbitrary origin.
+         */
+        std::uint64_t now();
+
+        /*!
+         * \brief Adds a zone to the buffer of the current thread.
+         * \param name A string living until the end of the program.
+         */
+        void addZone(const char *name, std::uint64_t start, std::uint64_t end);
+
+        /*!
+         * \brief Marks the beginning of a frame.
+         */
+        void newFrame();
+
+        /*!
+         * \brief Writes the zones of the last frames in a trace file.
+         * \returns `false` if the file couldn't be written or if the profiler is disabled.
+         */
+        bool dump(std::string const &path);
+
+        /*!
+         * \brief Measures the time between its construction and its destruction.
+         */
+        class Zone {
+          public:
+            explicit Zone(const char *name) : name(name), start(now()) {}
+            ~Zone() { addZone(name, start, now()); }
+            Zone(Zone const &) = delete;
+            Zone &operator=(Zone const &) = delete;
+
+          private:
+            const char *name;
+            std::uint64_t start;
+        };
+
+    } // namespace Profiler
+} // namespace Utils
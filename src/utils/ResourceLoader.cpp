@@ -13,6 +13,12 @@
 namespace Utils {
 
     std::string ResourceLoader::resourcePath = "";
+    std::unordered_map<std::string, ResourceLoader::PreloadedImage>
+        ResourceLoader::preloadedImages;
+    unsigned int ResourceLoader::preloadGeneration = 0;
+    std::mutex ResourceLoader::preloadedImagesMutex;
+    std::unordered_map<std::string, std::weak_ptr<const sf::Texture>>
+        ResourceLoader::sharedTextures;
 
     std::string ResourceLoader::getResourcePath() { return resourcePath; }
 
@@ -24,6 +30,108 @@ namespace Utils {
         return !getResourcePath().empty();
     }
 
+    bool ResourceLoader::takePreloadedImage(std::string const &path,
+                                            sf::Image &image) {
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        auto found = preloadedImages.find(path);
+        if(found == preloadedImages.end()) {
+            return false;
+        }
+        image = std::move(found->second.image);
+        preloadedImages.erase(found);
+        return true;
+    }
+
+    void ResourceLoader::load(sf::Texture &resource, std::string path,
+                              bool fatal) {
+        sf::Image image;
+        if(!takePreloadedImage(path, image)) {
+            load<sf::Texture>(resource, path, fatal);
+            return;
+        }
+        try {
+            if(!resource.loadFromImage(image)) {
+                throw LoadingException(path, fatal);
+            }
+        } catch(LoadingException &e) {
+            if(e.fatal)
+                throw;
+            else
+                Log::warn(e.desc());
+        }
+    }
+
+    void ResourceLoader::load(sf::Image &resource, std::string path,
+                              bool fatal) {
+        if(!takePreloadedImage(path, resource)) {
+            load<sf::Image>(resource, path, fatal);
+        }
+    }
+
+    std::shared_ptr<const sf::Texture>
+    ResourceLoader::loadShared(std::string const &path, bool fatal) {
+        auto found = sharedTextures.find(path);
+        if(found != sharedTextures.end()) {
+            if(auto texture = found->second.lock()) {
+                return texture;
+            }
+        }
+        auto texture = std::make_shared<sf::Texture>();
+        load(*texture, path, fatal);
+        // Forgets the textures which aren't used anymore
+        std::erase_if(sharedTextures, [](auto const &shared) {
+            return shared.second.expired();
+        });
+        sharedTextures[path] = texture;
+        return texture;
+    }
+
+    void ResourceLoader::loadSharedArray(
+        std::vector<std::shared_ptr<const sf::Texture>> &container,
+        std::string path, size_t nb_frame, size_t path_offset) {
+        for(size_t i = 0; i < nb_frame; ++i) {
+            char buffer[2048];
+
+            snprintf(buffer, 2048, path.c_str(), i + path_offset);
+            container.push_back(loadShared(buffer));
+        }
+    }
+
+    void ResourceLoader::preloadImage(std::string const &path) {
+        {
+            std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            if(preloadedImages.count(path) != 0) {
+                return;
+            }
+        }
+        sf::Image image;
+        // Errors are reported when the texture is loaded from the file
+        if(image.loadFromFile(ResourceLoader::getResourcePath() + path)) {
+            std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            preloadedImages.emplace(
+                path, PreloadedImage {std::move(image), preloadGeneration});
+        }
+    }
+
+    void ResourceLoader::discardPreloadedImages() {
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        std::erase_if(preloadedImages, [](auto const &preloaded) {
+            return preloaded.second.generation < preloadGeneration;
+        });
+        preloadGeneration++;
+    }
+
+    void ResourceLoader::preloadImageArray(std::string const &path,
+                                           size_t nb_frame,
+                                           size_t path_offset) {
+        for(size_t i = 0; i < nb_frame; ++i) {
+            char buffer[2048];
+
+            snprintf(buffer, 2048, path.c_str(), i + path_offset);
+            preloadImage(buffer);
+        }
+    }
+
     void ResourceLoader::loadTextureArray(sf::Texture container[],
                                           std::string path, size_t nb_frame,
                                           size_t path_offset) {
@@ -36,6 +144,18 @@ namespace Utils {
         }
     }
 
+    void ResourceLoader::loadImageArray(std::vector<sf::Image> &container,
+                                        std::string path, size_t nb_frame,
+                                        size_t path_offset) {
+        for(size_t i = 0; i < nb_frame; ++i) {
+            char buffer[2048];
+
+            container.emplace_back();
+            snprintf(buffer, 2048, path.c_str(), i + path_offset);
+            ResourceLoader::load(container.back(), buffer);
+        }
+    }
+
     void ResourceLoader::loadTextureArray(std::vector<sf::Texture> &container,
                                           std::string path, size_t nb_frame,
                                           size_t path_offset) {
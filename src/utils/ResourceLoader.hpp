@@ -10,6 +10,9 @@
 #include <cstddef>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "exceptions.hpp"
@@ -45,6 +48,58 @@ namespace Utils {
         template <typename T>
         static void load(T &resource, std::string path, bool fatal = false);
 
+        /*!
+         * \brief Loads a texture.
+         * \details If the image has been decoded by preloadImage(), it is only sent to the graphics card, and then removed from the preloaded images.
+         * \copydetails load(T &resource, std::string path, bool fatal)
+         */
+        static void load(sf::Texture &resource, std::string path,
+                         bool fatal = false);
+
+        /*!
+         * \brief Loads an image.
+         * \details If the image has been decoded by preloadImage(), it is taken from the preloaded images instead of being read again.
+         * \copydetails load(T &resource, std::string path, bool fatal)
+         */
+        static void load(sf::Image &resource, std::string path,
+                         bool fatal = false);
+
+        /*!
+         * \brief Gets a texture shared between all the objects using it.
+         * \details The texture is loaded the first time it is asked for, and is kept while a handle to it exists: the next calls return a handle to the same texture instead of loading a copy. It is freed when the last handle is destroyed. Must be called from the main thread.
+         * \copydetails load(T &resource, std::string path, bool fatal)
+         */
+        static std::shared_ptr<const sf::Texture>
+        loadShared(std::string const &path, bool fatal = false);
+
+        /*!
+         * \brief Gets the shared textures of an array of textures.
+         * \details See loadTextureArray() for the parameters and loadShared() for the sharing. The handles are added at the end of the container.
+         */
+        static void loadSharedArray(
+            std::vector<std::shared_ptr<const sf::Texture>> &container,
+            std::string path, size_t nb_frame, size_t path_offset = 0);
+
+        /*!
+         * \brief Reads and decodes an image, to be sent to the graphics card by the next call to load(sf::Texture&, std::string, bool) with the same path.
+         * \details This method doesn't use the graphics context, so it can be called from another thread to split the loading of the textures of a screen: the long part is done in a worker thread, and the main thread only uploads the textures. It is thread-safe.
+         * \param path - path of the image, relative to the resource folder.
+         */
+        static void preloadImage(std::string const &path);
+
+        /*!
+         * \brief Preloads the images of an array of textures.
+         * \details See loadTextureArray() for the parameters and preloadImage() for the preloading.
+         */
+        static void preloadImageArray(std::string const &path, size_t nb_frame,
+                                      size_t path_offset = 0);
+
+        /*!
+         * \brief Frees the preloaded images which haven't been used.
+         * \details Called by GameLoop each time a screen is loaded. The images preloaded since the previous call are kept, as they may be waiting for the screen just loaded, or for a screen loaded later (like a battle warming up); the older ones are freed. It is thread-safe.
+         */
+        static void discardPreloadedImages();
+
         /*!
          * \brief Loads an array of textures (multiple frames of the same animation).
          *
@@ -67,6 +122,14 @@ namespace Utils {
                                      std::string path, size_t nb_frame,
                                      size_t path_offset = 0);
 
+        /*!
+         * \brief Loads the images of an array of textures, without sending them to the graphics card.
+         * \details See loadTextureArray() for the parameters. The images are added at the end of the container.
+         */
+        static void loadImageArray(std::vector<sf::Image> &container,
+                                   std::string path, size_t nb_frame,
+                                   size_t path_offset = 0);
+
         /*!
          * \brief Loads a music.
          * \param path The path to the music file.
@@ -75,6 +138,40 @@ namespace Utils {
 
       private:
         static std::string resourcePath;
+
+        /*!
+         * \brief Moves the image preloaded for a path in `image`.
+         * \returns `false` if the image hasn't been preloaded.
+         */
+        static bool takePreloadedImage(std::string const &path,
+                                       sf::Image &image);
+
+        /*!
+         * \brief An image decoded by preloadImage().
+         */
+        struct PreloadedImage {
+            sf::Image image;
+            /*!
+             * \brief The value of ResourceLoader::preloadGeneration when the image has been decoded.
+             */
+            unsigned int generation;
+        };
+
+        /*!
+         * \brief The images decoded by preloadImage(), by path, waiting to be sent to the graphics card.
+         */
+        static std::unordered_map<std::string, PreloadedImage> preloadedImages;
+        /*!
+         * \brief The number of calls to discardPreloadedImages().
+         */
+        static unsigned int preloadGeneration;
+        static std::mutex preloadedImagesMutex;
+
+        /*!
+         * \brief The textures given by loadShared(), by path. Only the textures still used are alive.
+         */
+        static std::unordered_map<std::string, std::weak_ptr<const sf::Texture>>
+            sharedTextures;
     };
 
     template <typename T>
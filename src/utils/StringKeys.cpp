@@ -12,33 +12,20 @@
 #include <algorithm>
 #include <cstdio>
 #include <ext/alloc_traits.h>
+#include <deque>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <queue>
 
 #include "./log.hpp"
+#include "TextLayout.hpp"
 #include "exceptions.hpp"
+#include "i18n/LanguagePack.hpp"
 
 namespace Utils {
 
-    sf::String StringKeys::readLine(std::ifstream &input) {
-        std::basic_string<unsigned char> toReturn;
-        for(unsigned int i = 0; i < 1024; i++) {
-            int got = input.get();
-            // char traded = got;
-            if(got == '\n' || got < 31) {
-                break;
-            } else {
-                unsigned char truc = got;
-                toReturn += truc;
-            }
-        }
-        sf::String toReelReturn;
-        toReelReturn = sf::String::fromUtf8(toReturn.begin(), toReturn.end());
-        return toReelReturn;
-    }
-
     std::string StringKeys::sfStringtoStdString(sf::String const &str) {
         std::string toReelReturn;
         std::basic_string<unsigned char> bs = str.toUtf8();
@@ -49,178 +36,86 @@ namespace Utils {
     }
 
     StringKeys::StringKeys(const std::string &keysFileS) {
-        std::ifstream keysFile(keysFileS);
-        keys = std::vector<std::string>();
-        strings = std::vector<sf::String>();
-        Log::oplog("Keys initialization");
-        if(!keysFile) {
-            throw LoadingException(keysFileS, true);
-        }
-        // Keys recovering
-        int itore = 0;
-        while(true) {
-            sf::String read;
-            read = readLine(keysFile);
-            if((sfStringtoStdString(read) ==
-                "end")) { // Checks if the line is not the ending line
-                break;    // Else, stops reading
-            }
-            // Splits the string in two parts
-            if(read[0] != '#' || read[0] != ' ' ||
-               !read.isEmpty()) { // Checks if the string is valid
-                std::vector<sf::String> strSplit = split(read, '=');
-                if(!strSplit.size() == 0 && strSplit[0] != "") {
-                    keys.push_back(strSplit[0]);
-                    if(strSplit.size() < 2) {
-                        strings.push_back(" ");
-                    } else {
-                        strings.push_back(sf::String(strSplit[1]));
-                        itore++;
-                    }
-                }
-            }
-        }
+        setPack(std::make_shared<const I18n::LanguagePack>(keysFileS));
     }
 
-    sf::String &StringKeys::get(std::string key) {
-        key = std::string("key.") + key;                // Adding "key" prefix
-        for(unsigned int i = 0; i < keys.size(); i++) { // Scans keys
-            if(keys[i] == key) {
-                return strings[i];
-            }
-        }
-        Log::warn("Key " + key + " not found in the keys files.");
-        return strings[getIndex(
-            "void")]; // If nothing found, returns the empty string.
+    void StringKeys::setPack(std::shared_ptr<const I18n::LanguagePack> pack) {
+        static unsigned int packChanges = 0;
+        this->pack = std::move(pack);
+        generation = ++packChanges;
     }
 
-    int StringKeys::getIndex(std::string key) {
-        key = std::string("key.") + key;                // Adding "key" prefix
-        for(unsigned int i = 0; i < keys.size(); i++) { // Scans keys
-            if(keys[i] == key) {
-                return i;
-            }
+    sf::String StringKeys::get(std::string const &key) const {
+        int found = getIndex(key);
+        if(found != -1) {
+            return getTemplate(found).getText();
         }
-        return -1; // If nothing found, returns -1
+        Log::warn("Key key." + key + " not found in the keys files.");
+        // If nothing found, returns the empty string.
+        found = getIndex("void");
+        return found != -1 ? getTemplate(found).getText() : sf::String();
+    }
+
+    int StringKeys::getIndex(std::string const &key) const {
+        return pack != nullptr ? pack->getIndex(key) : -1;
+    }
+
+    StringTemplate StringKeys::getTemplate(int index) const {
+        return pack->getTemplate(index);
+    }
+
+    std::vector<sf::Uint32> StringKeys::getCharacters() const {
+        return pack != nullptr ? pack->getCharacters()
+                               : std::vector<sf::Uint32>();
     }
 
     sf::String StringKeys::split(sf::String const &str, char const &splitter,
                                  int const &part) {
-        int instances = 0; // Counts splitter's instances
-        for(unsigned int i = 0; i < str.toUtf32().size();
-            i++) { // Scans the string to find the number of splitter's intances
-            if((char)str.toUtf32()[i] == splitter) {
-                instances++;
-            }
-        }
-        std::vector<sf::String> toReturn(
-            instances + 1); // Create an array containing all the splits
-        for(unsigned int i = 0, enCours = 0; i < str.toUtf32().size();
-            i++) { // Browses the array to split it
-            if((char)str.toUtf32()[i] == splitter) {
-                enCours++;
-            } else {
-                toReturn[enCours] += str.toUtf32()[i];
-            }
-        }
-        return toReturn[part];
+        return split(str, splitter)[part];
     }
-    // TODO : Factorize code to avoid copy-pasted code
+
     std::vector<sf::String> StringKeys::split(sf::String const &str,
                                               char const &splitter) {
-        int instances = 0; // Counts splitter's instances
-        for(unsigned int i = 0; i < str.toUtf32().size();
-            i++) { // Scans the string to find the number of splitter's intances
-            if((char)str.toUtf32()[i] == splitter) {
-                instances++;
-            }
-        }
-        std::vector<sf::String> toReturn(
-            instances + 1); // Create an array containing all the splits
-        for(unsigned int i = 0, enCours = 0; i < str.toUtf32().size();
-            i++) { // Browses the array to split it
-            if((char)str.toUtf32()[i] == splitter) {
-                enCours++;
-            } else {
-                toReturn[enCours] += str.toUtf32()[i];
+        std::vector<sf::String> toReturn;
+        const sf::Uint32 *data = str.getData();
+        const std::size_t size = str.getSize();
+        std::size_t start = 0;
+        // Browses the string once, cutting it at each splitter
+        for(std::size_t i = 0; i < size; i++) {
+            if((char)data[i] == splitter) {
+                toReturn.push_back(str.substring(start, i - start));
+                start = i + 1;
             }
         }
+        toReturn.push_back(str.substring(start, size - start));
 
         return toReturn;
     }
 
     int StringKeys::countInstances(sf::String const &str,
                                    char const &toSearch) {
-        int instances = 0;
-        for(unsigned int i = 0; i < str.toUtf32().size(); i++) {
-            if((char)str.toUtf32()[i] == toSearch) {
-                instances++;
-            }
-        }
-        return instances;
+        return std::count_if(str.begin(), str.end(), [&](sf::Uint32 c) {
+            return (char)c == toSearch;
+        });
     }
 
-    std::string StringKeys::getStd(std::string const &key) {
+    std::string StringKeys::getStd(std::string const &key) const {
+        int found = getIndex(key);
+        if(found != -1) {
+            // The strings are already stored in UTF-8
+            return std::string(getTemplate(found).getUtf8());
+        }
         return sfStringtoStdString(get(key));
     }
 
-    std::queue<sf::String> StringKeys::autoNewLine(sf::String str,
-                                                   sf::Font font,
+    std::queue<sf::String> StringKeys::autoNewLine(sf::String const &str,
+                                                   sf::Font const &font,
                                                    unsigned int characterSize,
                                                    float limit) {
-        sf::String currentWord;
-        std::queue<sf::String> lines;
-        lines.push(sf::String());
-
-        // Temporary text used to measure the size
-        sf::Text testText;
-        testText.setFont(font);
-        testText.setCharacterSize(characterSize);
-
-        for(unsigned int i = 0; i < str.getSize(); i++) {
-            if(str[i] != ' ' && str[i] != '|' && str[i] != '$' &&
-               i != (str.getSize() - 1)) {
-                currentWord += str[i];
-            } else {
-                sf::String currentLine = lines.back() + " " + currentWord;
-
-                // Calculate the width that a text with the given font and
-                // character size would have with the current string
-                testText.setString(currentLine);
-                float testTextWidth = testText.getLocalBounds().width;
-
-                // If this width is over the limit, generate a new line
-                if(testTextWidth > limit) {
-                    lines.push(sf::String());
-                }
-
-                if(i == str.getSize() - 1) {
-                    currentWord += str[i];
-                }
-
-                lines.back() += currentWord;
-
-                if(str[i] == ' ') {
-                    lines.back() += " ";
-                }
-
-                currentWord.clear();
-
-                if(str[i] == '|' || str[i] == '$') {
-                    lines.push(sf::String());
-                }
-                while(str[i] == '$' && (lines.size() % 2) != 1) {
-                    lines.back() += " ";
-                    lines.push(sf::String());
-                }
-            }
-        }
-        if(lines.back().isEmpty()) {
-            lines.back() += " ";
-        }
-        while((lines.size() % 2) != 0) {
-            lines.push(sf::String(" "));
-        }
-        return lines;
+        std::vector<sf::String> lines =
+            TextLayout::get(font, characterSize).wrap(str, limit);
+        return std::queue<sf::String>(
+            std::deque<sf::String>(std::make_move_iterator(lines.begin()),
+                                   std::make_move_iterator(lines.end())));
     }
 } // namespace Utils
@@ -11,47 +11,72 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/System/String.hpp>
 #include <iostream>
+#include <memory>
 #include <queue>
+#include <string>
 #include <vector>
 
+#include "StringTemplate.hpp"
 #include "defines.hpp"
 
 /*! \namespace Utils
  *  \brief Contains different utilities.
  */
 namespace Utils {
+    namespace I18n {
+        class LanguagePack;
+    } // namespace I18n
+
     /*!
      *  \brief Contains functions to manage game strings.
+     *  \details The strings themselves are stored in a I18n::LanguagePack. Changing the language only replaces the pack used.
      */
     class StringKeys {
       private:
         /*!
-         * \brief The array containing the keys.
-         * \todo Replace it by one map.
+         * \brief The strings of the current language.
          */
-        std::vector<std::string> keys;
+        std::shared_ptr<const I18n::LanguagePack> pack;
         /*!
-         * \brief The array containing the strings.
-         * \todo Replace it by one map.
+         * \brief A number identifying the current pack.
+         * \details Each change of pack gives a new number, so objects caching indexes can know when they need to look up the key again.
          */
-        std::vector<sf::String> strings;
+        unsigned int generation = 0;
 
+      public:
         /*!
-         * \brief Returns the index of the given key.
+         * \return The character string associated with the key.
+         * \param key The key corresponding to the wanted string.
          */
-        int getIndex(std::string key);
+        sf::String get(std::string const &key) const;
 
         /*!
-         * \brief Reads a line from the input.
+         * \brief Returns the index of the given key, or -1 if the key doesn't exist.
+         * \details The index stays valid as long as getGeneration() returns the same number.
+         * \param key The key, without its "key." prefix.
          */
-        sf::String readLine(std::ifstream &input);
+        int getIndex(std::string const &key) const;
 
-      public:
         /*!
-         * \return The character string associated with the key.
-         * \param key The key corresponding to the wanted string.
+         * \brief Returns the template of the string at the given index.
+         * \param index An index returned by getIndex(), different from -1.
+         */
+        StringTemplate getTemplate(int index) const;
+
+        /*!
+         * \brief Returns all the different characters used by the strings, sorted.
+         */
+        std::vector<sf::Uint32> getCharacters() const;
+
+        /*!
+         * \brief Returns the number identifying the current pack.
+         */
+        unsigned int getGeneration() const { return generation; }
+
+        /*!
+         * \brief Replaces the strings by the strings of another pack.
          */
-        sf::String &get(std::string key);
+        void setPack(std::shared_ptr<const I18n::LanguagePack> pack);
 
         /*!
          * \brief Loads the file containing the keys and initializes the list of them.
@@ -97,7 +122,7 @@ namespace Utils {
          * \return The string associated with the key in std::string format.
          * \param key The key corresponding to the wanted string.
          */
-        std::string getStd(std::string const &key);
+        std::string getStd(std::string const &key) const;
 
         /**
          * \brief Counts the number of instances of a character into a string.
@@ -108,13 +133,14 @@ namespace Utils {
 
         /*!
          * \brief Splits a string into different strings according to the fixed size limit while respecting the words.
-         * \details Special characters used: "|" to make a new line manually, "$" to go to the next dialog manually.
+         * \details Special characters used: "|" to make a new line manually, "$" to go to the next dialog manually. See TextLayout::wrap.
          * \param str The string to cut.
          * \param font The font used to calculate the size of the text.
          * \param characterSize The character size used to calculate the size of the text.
          * \param limit The size limit, 456 by default to fit in a standard OpMon dialog box.
          */
-        static std::queue<sf::String> autoNewLine(sf::String str, sf::Font font,
+        static std::queue<sf::String> autoNewLine(sf::String const &str,
+                                                  sf::Font const &font,
                                                   unsigned int characterSize,
                                                   float limit);
     };
@@ -0,0 +1,28 @@
+/*
+StringTemplate.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "StringTemplate.hpp"
+
+#include <SFML/System/Utf.hpp>
+
+namespace Utils {
+
+    sf::String StringTemplate::getText() const {
+        return sf::String::fromUtf8(text.begin(), text.end());
+    }
+
+    void StringTemplate::appendText(std::basic_string<sf::Uint32> &buffer,
+                                    std::uint32_t start,
+                                    std::uint32_t end) const {
+        sf::Utf8::toUtf32(text.begin() + start, text.begin() + end,
+                          std::back_inserter(buffer));
+    }
+
+    std::basic_string<sf::Uint32> &StringTemplate::getBuffer() {
+        static std::basic_string<sf::Uint32> buffer;
+        return buffer;
+    }
+
+} // namespace Utils
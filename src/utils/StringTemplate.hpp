@@ -0,0 +1,119 @@
+/*!
+ * \file StringTemplate.hpp
+ * \brief A string with placeholders, parsed once.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0 license
+ */
+#ifndef STRINGTEMPLATE_HPP
+#define STRINGTEMPLATE_HPP
+
+#include <SFML/System/String.hpp>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace Utils {
+
+    /*!
+     * \brief A character string in which every `~` is a placeholder.
+     * \details The template is a view on a string and on the positions of its placeholders, both found once when the language is loaded (see I18n::LanguagePack). Formatting the template then only decodes the literal parts and copies the arguments into a buffer reused between calls. A caller keeping its own UTF-32 buffer doesn't allocate once the buffer is large enough; a sf::String result is copied from the buffer, as sf::String can't reuse its storage.
+     * \warning The template doesn't own its data, and must not be kept after the destruction of the language pack it comes from.
+     */
+    class StringTemplate {
+      private:
+        /*!
+         * \brief The whole string in UTF-8, placeholders included.
+         */
+        std::string_view text;
+        /*!
+         * \brief The positions of the placeholders in StringTemplate::text, in bytes.
+         */
+        const std::uint32_t *slots = nullptr;
+        /*!
+         * \brief The number of placeholders.
+         */
+        unsigned int slotCount = 0;
+
+        /*!
+         * \brief Appends a part of the template to the buffer.
+         */
+        void appendText(std::basic_string<sf::Uint32> &buffer,
+                        std::uint32_t start, std::uint32_t end) const;
+
+        /*!
+         * \brief The buffer used to build the formatted strings.
+         */
+        static std::basic_string<sf::Uint32> &getBuffer();
+
+        static const sf::String &deref(const sf::String *str) { return *str; }
+        static const sf::String &deref(const sf::String &str) { return str; }
+
+      public:
+        StringTemplate() = default;
+        /*!
+         * \param text The string in UTF-8.
+         * \param slots The positions of the `~` in the string, in bytes.
+         * \param slotCount The number of `~` in the string.
+         */
+        StringTemplate(std::string_view text, const std::uint32_t *slots,
+                       unsigned int slotCount)
+            : text(text), slots(slots), slotCount(slotCount) {}
+
+        /*!
+         * \returns The string, placeholders included.
+         */
+        sf::String getText() const;
+        /*!
+         * \returns The string in UTF-8, placeholders included.
+         */
+        std::string_view getUtf8() const { return text; }
+
+        /*!
+         * \returns The number of placeholders in the string.
+         */
+        unsigned int getSlotCount() const { return slotCount; }
+
+        /*!
+         * \brief Completes the placeholders with the given arguments.
+         * \details The arguments are used one by one. If there isn't enough arguments, the remaining `~` are kept, and if there is too much arguments, they are ignored. The memory of `out` is reused, so formatting again and again into the same buffer doesn't allocate.
+         * \param args A range of sf::String or of pointers to sf::String.
+         * \param out The buffer receiving the result, in UTF-32.
+         */
+        template <typename Args>
+        void format(Args const &args,
+                    std::basic_string<sf::Uint32> &out) const {
+            out.clear();
+            auto arg = std::begin(args);
+            std::uint32_t start = 0;
+            for(unsigned int i = 0; i < slotCount; i++) {
+                appendText(out, start, slots[i]);
+                if(arg != std::end(args)) {
+                    const sf::String &str = deref(*arg);
+                    out.append(str.getData(), str.getSize());
+                    ++arg;
+                } else {
+                    out.push_back('~');
+                }
+                start = slots[i] + 1;
+            }
+            appendText(out, start, text.size());
+        }
+
+        /*!
+         * \brief Completes the placeholders with the given arguments.
+         * \details Formats in a shared buffer, then copies it in `out`: this copy is the only allocation.
+         * \param args A range of sf::String or of pointers to sf::String.
+         * \param out The string receiving the result.
+         */
+        template <typename Args>
+        void format(Args const &args, sf::String &out) const {
+            std::basic_string<sf::Uint32> &buffer = getBuffer();
+            format(args, buffer);
+            out = sf::String(buffer);
+        }
+    };
+
+} // namespace Utils
+
+#endif // STRINGTEMPLATE_HPP
@@ -0,0 +1,259 @@
+/*
+TextLayout.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "TextLayout.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "OpString.hpp"
+#include "StringKeys.hpp"
+
+namespace Utils {
+
+    TextLayout::TextLayout(sf::Font const &font, unsigned int characterSize)
+        : font(font), characterSize(characterSize) {}
+
+    namespace {
+        std::map<std::pair<const sf::Font *, unsigned int>,
+                 std::unique_ptr<TextLayout>> &
+        getLayouts() {
+            static std::map<std::pair<const sf::Font *, unsigned int>,
+                            std::unique_ptr<TextLayout>>
+                layouts;
+            return layouts;
+        }
+    } // namespace
+
+    TextLayout &TextLayout::get(sf::Font const &font,
+                                unsigned int characterSize) {
+        auto &layouts = getLayouts();
+        std::unique_ptr<TextLayout> &layout =
+            layouts[std::make_pair(&font, characterSize)];
+        if(layout == nullptr) {
+            layout = std::make_unique<TextLayout>(font, characterSize);
+        }
+        return *layout;
+    }
+
+    void TextLayout::release(sf::Font const &font) {
+        auto &layouts = getLayouts();
+        for(auto itor = layouts.begin(); itor != layouts.end();) {
+            if(itor->first.first == &font) {
+                itor = layouts.erase(itor);
+            } else {
+                ++itor;
+            }
+        }
+    }
+
+    void TextLayout::prewarm(std::vector<sf::Uint32> const &characters) {
+        for(sf::Uint32 character : characters) {
+            if(character > 10) {
+                // Getting the advance loads the glyph
+                getAdvance(character);
+            }
+        }
+    }
+
+    float TextLayout::getAdvance(sf::Uint32 character) {
+        auto found = advances.find(character);
+        if(found != advances.end()) {
+            return found->second;
+        }
+        float advance = font.getGlyph(character, characterSize, false).advance;
+        advances.emplace(character, advance);
+        return advance;
+    }
+
+    float TextLayout::getKerning(sf::Uint32 first, sf::Uint32 second) {
+        std::uint64_t pair = ((std::uint64_t)first << 32) | second;
+        auto found = kernings.find(pair);
+        if(found != kernings.end()) {
+            return found->second;
+        }
+        float kerning = font.getKerning(first, second, characterSize);
+        kernings.emplace(pair, kerning);
+        return kerning;
+    }
+
+    float TextLayout::measure(sf::String const &str) {
+        // Same computation as sf::Text
+        const float spaceWidth = getAdvance(' ');
+        float width = 0;
+        float x = 0;
+        sf::Uint32 previous = 0;
+        for(sf::Uint32 character : str) {
+            if(previous != 0) {
+                x += getKerning(previous, character);
+            }
+            previous = character;
+            switch(character) {
+                case ' ':
+                    x += spaceWidth;
+                    break;
+                case '\t':
+                    x += spaceWidth * 4;
+                    break;
+                case '\n':
+                    width = std::max(width, x);
+                    x = 0;
+                    break;
+                default:
+                    x += getAdvance(character);
+            }
+        }
+        return std::max(width, x);
+    }
+
+    void TextLayout::appendGlyphs(sf::String const &str, sf::Vector2f position,
+                                  sf::Color color,
+                                  std::vector<sf::Vertex> &vertices,
+                                  std::vector<std::size_t> *ends) {
+        // Same placement as sf::Text, with the baseline one character size
+        // below the top of the text.
+        const float padding = 1;
+        const float spaceWidth = getAdvance(' ');
+        float x = position.x;
+        const float y = position.y + characterSize;
+        sf::Uint32 previous = 0;
+        for(sf::Uint32 character : str) {
+            if(previous != 0) {
+                x += getKerning(previous, character);
+            }
+            previous = character;
+            if(character == ' ' || character == '\t') {
+                x += character == ' ' ? spaceWidth : spaceWidth * 4;
+            } else if(character > 10) {
+                const sf::Glyph &glyph =
+                    font.getGlyph(character, characterSize, false);
+                float left = glyph.bounds.left - padding;
+                float top = glyph.bounds.top - padding;
+                float right = glyph.bounds.left + glyph.bounds.width + padding;
+                float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+                float u1 = glyph.textureRect.left - padding;
+                float v1 = glyph.textureRect.top - padding;
+                float u2 =
+                    glyph.textureRect.left + glyph.textureRect.width + padding;
+                float v2 =
+                    glyph.textureRect.top + glyph.textureRect.height + padding;
+
+                vertices.emplace_back(sf::Vector2f(x + left, y + top), color,
+                                      sf::Vector2f(u1, v1));
+                vertices.emplace_back(sf::Vector2f(x + right, y + top), color,
+                                      sf::Vector2f(u2, v1));
+                vertices.emplace_back(sf::Vector2f(x + right, y + bottom),
+                                      color, sf::Vector2f(u2, v2));
+                vertices.emplace_back(sf::Vector2f(x + left, y + bottom), color,
+                                      sf::Vector2f(u1, v2));
+                x += glyph.advance;
+            }
+            if(ends != nullptr) {
+                ends->push_back(vertices.size());
+            }
+        }
+    }
+
+    std::vector<sf::String> TextLayout::wrap(sf::String const &str,
+                                             float limit) {
+        std::vector<std::basic_string<sf::Uint32>> lines(1);
+        std::basic_string<sf::Uint32> currentWord;
+        // The widths are updated along with the strings, so that nothing is
+        // measured twice.
+        float lineWidth = 0;
+        float wordWidth = 0;
+        const float spaceWidth = getAdvance(' ');
+        const sf::Uint32 *data = str.getData();
+        const std::size_t size = str.getSize();
+
+        for(std::size_t i = 0; i < size; i++) {
+            sf::Uint32 character = data[i];
+            if(character != ' ' && character != '|' && character != '$' &&
+               i != (size - 1)) {
+                if(!currentWord.empty()) {
+                    wordWidth += getKerning(currentWord.back(), character);
+                }
+                wordWidth += getAdvance(character);
+                currentWord += character;
+            } else {
+                // If the line would go over the limit with the current word,
+                // generate a new line
+                if(lineWidth + spaceWidth + wordWidth > limit) {
+                    lines.emplace_back();
+                    lineWidth = 0;
+                }
+
+                if(i == size - 1) {
+                    currentWord += character;
+                    wordWidth += getAdvance(character);
+                }
+
+                lines.back() += currentWord;
+                lineWidth += wordWidth;
+
+                if(character == ' ') {
+                    lines.back() += ' ';
+                    lineWidth += spaceWidth;
+                }
+
+                currentWord.clear();
+                wordWidth = 0;
+
+                if(character == '|' || character == '$') {
+                    lines.emplace_back();
+                    lineWidth = 0;
+                }
+                while(character == '$' && (lines.size() % 2) != 1) {
+                    lines.back() += ' ';
+                    lines.emplace_back();
+                }
+            }
+        }
+        if(lines.back().empty()) {
+            lines.back() += ' ';
+        }
+        while((lines.size() % 2) != 0) {
+            lines.emplace_back(1, ' ');
+        }
+
+        std::vector<sf::String> toReturn;
+        toReturn.reserve(lines.size());
+        for(std::basic_string<sf::Uint32> const &line : lines) {
+            toReturn.emplace_back(line);
+        }
+        return toReturn;
+    }
+
+    const std::vector<sf::String> &
+    TextLayout::wrap(StringKeys &keys, std::string const &key, float limit) {
+        CachedLines &cached = cachedLines[std::make_pair(key, limit)];
+        if(cached.lines.empty() || cached.generation != keys.getGeneration()) {
+            cached.lines = wrap(keys.get(key), limit);
+            cached.generation = keys.getGeneration();
+        }
+        return cached.lines;
+    }
+
+    const std::vector<sf::String> &
+        TextLayout::wrap(StringKeys &keys, OpString const &str, float limit) {
+        if(str.getObjectCount() == 0) {
+            return wrap(keys, str.getKey(), limit);
+        }
+        // The objects are separated by a character which can't be in a key
+        std::string id = str.getKey();
+        for(std::size_t i = 0; i < str.getObjectCount(); i++) {
+            auto utf8 = str.getObject(i).toUtf8();
+            id += '\0';
+            id.append(utf8.begin(), utf8.end());
+        }
+        CachedLines &cached = cachedLines[std::make_pair(id, limit)];
+        if(cached.lines.empty() || cached.generation != keys.getGeneration()) {
+            cached.lines = wrap(str.getString(keys), limit);
+            cached.generation = keys.getGeneration();
+        }
+        return cached.lines;
+    }
+
+} // namespace Utils
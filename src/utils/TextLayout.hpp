@@ -0,0 +1,150 @@
+/*!
+ * \file TextLayout.hpp
+ * \brief Measures and wraps texts without building sf::Text objects.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0 license
+ */
+#ifndef TEXTLAYOUT_HPP
+#define TEXTLAYOUT_HPP
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/String.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Utils {
+
+    class OpString;
+    class StringKeys;
+
+    /*!
+     * \brief Lays out texts for a font and a character size.
+     * \details The advances of the glyphs and the kerning between them are asked to the font once, then cached. The width of a text is computed the same way sf::Text places its glyphs, so the texts can be measured and wrapped without creating any sf::Text.
+     */
+    class TextLayout {
+      private:
+        const sf::Font &font;
+        unsigned int characterSize;
+
+        /*!
+         * \brief The cached advances of the glyphs.
+         */
+        std::unordered_map<sf::Uint32, float> advances;
+        /*!
+         * \brief The cached kerning between two characters, indexed by the two characters packed in one number.
+         */
+        std::unordered_map<std::uint64_t, float> kernings;
+
+        /*!
+         * \brief A wrapped string of StringKeys.
+         */
+        struct CachedLines {
+            /*!
+             * \brief The generation of StringKeys used to build the lines.
+             */
+            unsigned int generation = 0;
+            std::vector<sf::String> lines;
+        };
+        /*!
+         * \brief The wrapped strings, indexed by key and width limit.
+         */
+        std::map<std::pair<std::string, float>, CachedLines> cachedLines;
+
+      public:
+        TextLayout(sf::Font const &font, unsigned int characterSize);
+
+        /*!
+         * \brief Returns the layout of a font and a character size.
+         * \details The layouts are shared, so the cached metrics are kept between the calls.
+         */
+        static TextLayout &get(sf::Font const &font,
+                               unsigned int characterSize);
+
+        /*!
+         * \brief Returns the horizontal advance of a character.
+         */
+        float getAdvance(sf::Uint32 character);
+
+        /*!
+         * \brief Returns the kerning between two characters.
+         */
+        float getKerning(sf::Uint32 first, sf::Uint32 second);
+
+        /*!
+         * \brief Loads the glyphs of the given characters in the font.
+         * \details SFML rasterizes a glyph the first time it is used. Calling this method during a loading avoids doing it while the game is running.
+         */
+        void prewarm(std::vector<sf::Uint32> const &characters);
+
+        /*!
+         * \brief Forgets the layouts of a font.
+         * \details Must be called before destroying a font used with get().
+         */
+        static void release(sf::Font const &font);
+
+        /*!
+         * \brief Returns the width of a single line text.
+         */
+        float measure(sf::String const &str);
+
+        /*!
+         * \brief Appends the quads of the glyphs of a single line text to an array.
+         * \details The quads are placed like sf::Text would place them, and use the texture returned by getTexture().
+         * \param str The text.
+         * \param position The position of the top left corner of the text.
+         * \param color The color of the text.
+         * \param vertices The array receiving the quads.
+         * \param ends If not `nullptr`, receives for each character the size of the array once the character is added. Allows to show only the beginning of the text.
+         */
+        void appendGlyphs(sf::String const &str, sf::Vector2f position,
+                          sf::Color color, std::vector<sf::Vertex> &vertices,
+                          std::vector<std::size_t> *ends = nullptr);
+
+        /*!
+         * \brief Returns the texture containing the glyphs.
+         * \warning The texture can change when new glyphs are loaded, so it must be asked again before each draw.
+         */
+        const sf::Texture &getTexture() const {
+            return font.getTexture(characterSize);
+        }
+
+        /*!
+         * \brief Splits a string into different lines according to the fixed size limit while respecting the words.
+         * \details Special characters used: "|" to make a new line manually, "$" to go to the next dialog manually. The number of lines returned is always even, so that a dialog box can show them two by two.
+         * \param str The string to cut.
+         * \param limit The width limit.
+         */
+        std::vector<sf::String> wrap(sf::String const &str, float limit);
+
+        /*!
+         * \brief Splits a string of StringKeys into lines, caching the result.
+         * \details The lines are computed once per key, language and limit, and kept until another language is loaded.
+         * \param keys The StringKeys instance containing the string.
+         * \param key The key of the string.
+         * \param limit The width limit.
+         */
+        const std::vector<sf::String> &wrap(StringKeys &keys,
+                                             std::string const &key,
+                                             float limit);
+
+        /*!
+         * \brief Splits a completed OpString into lines, caching the result.
+         * \details The lines are cached like with a key, the values of the objects completing the string being part of the key.
+         * \param keys The StringKeys instance containing the string.
+         * \param str The string to complete and split.
+         * \param limit The width limit.
+         */
+        const std::vector<sf::String> &
+            wrap(StringKeys &keys, OpString const &str, float limit);
+    };
+
+} // namespace Utils
+
+#endif // TEXTLAYOUT_HPP
@@ -0,0 +1,143 @@
+/*
+TextureAtlas.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "TextureAtlas.hpp"
+
+#include <algorithm>
+
+#include "log.hpp"
+
+namespace Utils {
+
+    namespace {
+        /*!
+         * \brief The maximal size of a page, lowered if the graphics card doesn't support it.
+         */
+        constexpr unsigned int MAX_PAGE_SIZE = 2048;
+
+        /*!
+         * \brief The images are packed in rows, from the top left of the page.
+         */
+        struct PageLayout {
+            unsigned int width = 0;
+            unsigned int height = 0;
+            unsigned int x = 0;
+            unsigned int y = 0;
+            unsigned int rowHeight = 0;
+
+            bool isEmpty() const { return width == 0; }
+        };
+    } // namespace
+
+    unsigned int TextureAtlas::add(std::vector<sf::Image> group) {
+        unsigned int first = images.size();
+        groups.emplace_back(first, group.size());
+        for(sf::Image &image : group) {
+            images.push_back(std::move(image));
+        }
+        return first;
+    }
+
+    void TextureAtlas::pack() { pack(MAX_PAGE_SIZE); }
+
+    void TextureAtlas::pack(unsigned int maxSize) {
+        packedSize = maxSize;
+        regions.resize(images.size());
+
+        // Tries to put all the images of a group in a page. Only fails if the
+        // page isn't empty: a group too large for an empty page is cut.
+        auto place = [&](std::pair<unsigned int, unsigned int> group,
+                         PageLayout &layout, unsigned int page) {
+            bool wasEmpty = layout.isEmpty();
+            for(unsigned int i = group.first; i < group.first + group.second;
+                i++) {
+                sf::Vector2u size = images[i].getSize() +
+                                    sf::Vector2u(2 * PADDING, 2 * PADDING);
+                if(layout.x + size.x > maxSize) {
+                    layout.x = 0;
+                    layout.y += layout.rowHeight;
+                    layout.rowHeight = 0;
+                }
+                if(layout.y + size.y > maxSize && !wasEmpty) {
+                    return false;
+                }
+                regions[i] = {page, sf::IntRect(layout.x + PADDING,
+                                                layout.y + PADDING,
+                                                images[i].getSize().x,
+                                                images[i].getSize().y)};
+                layout.x += size.x;
+                layout.rowHeight = std::max(layout.rowHeight, size.y);
+                layout.width =
+                    std::min(maxSize, std::max(layout.width, layout.x));
+                layout.height = std::min(
+                    maxSize,
+                    std::max(layout.height, layout.y + layout.rowHeight));
+            }
+            return true;
+        };
+
+        std::vector<PageLayout> layouts(1);
+        for(auto const &group : groups) {
+            PageLayout layout = layouts.back();
+            if(!place(group, layout, layouts.size() - 1)) {
+                layouts.emplace_back();
+                layout = PageLayout();
+                place(group, layout, layouts.size() - 1);
+            }
+            layouts.back() = layout;
+        }
+
+        pageImages.assign(layouts.size(), sf::Image());
+        for(unsigned int page = 0; page < layouts.size(); page++) {
+            pageImages[page].create(std::max(1u, layouts[page].width),
+                                    std::max(1u, layouts[page].height),
+                                    sf::Color::Transparent);
+        }
+        for(unsigned int i = 0; i < images.size(); i++) {
+            Region const &region = regions[i];
+            if(images[i].getSize().x > maxSize ||
+               images[i].getSize().y > maxSize) {
+                Log::warn("An image of " +
+                          std::to_string(images[i].getSize().x) + "x" +
+                          std::to_string(images[i].getSize().y) +
+                          " is too large for the texture atlas and is cut.");
+            }
+            pageImages[region.page].copy(images[i], region.rect.left,
+                                         region.rect.top);
+        }
+    }
+
+    void TextureAtlas::upload() {
+        unsigned int maxSize =
+            std::min(sf::Texture::getMaximumSize(), MAX_PAGE_SIZE);
+        if(packedSize == 0 || packedSize > maxSize) {
+            pack(maxSize);
+        }
+        images.clear();
+        groups.clear();
+
+        pages.clear();
+        for(sf::Image const &image : pageImages) {
+            pages.push_back(std::make_unique<sf::Texture>());
+            if(!pages.back()->loadFromImage(image)) {
+                Log::warn("Unable to create a texture atlas page of " +
+                          std::to_string(image.getSize().x) + "x" +
+                          std::to_string(image.getSize().y));
+            }
+        }
+        pageImages.clear();
+        packedSize = 0;
+    }
+
+    void TextureAtlas::clear() {
+        images.clear();
+        groups.clear();
+        regions.clear();
+        pageImages.clear();
+        packedSize = 0;
+        pages.clear();
+    }
+
+} // namespace Utils
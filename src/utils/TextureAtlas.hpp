@@ -0,0 +1,105 @@
+/*!
+ * \file TextureAtlas.hpp
+ * \brief Packs many small images in a few textures.
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Utils {
+
+    /*!
+     * \brief Packs images in a few large textures, called pages.
+     * \details Drawing from a single texture lets many sprites be drawn in one draw call with a `sf::VertexArray`. The images are added in groups with add(), then pack() packs them in rows and upload() sends the pages to the graphics card. Only upload() uses the graphics context, the rest can be done in a worker thread. All the images of a group are put in the same page, so a group can be drawn with one texture.
+     *
+     * The images are then found by their index: the images of a group have consecutive indexes, starting with the one returned by add().
+     */
+    class TextureAtlas {
+      public:
+        /*!
+         * \brief The place of an image in the atlas.
+         */
+        struct Region {
+            unsigned int page;
+            sf::IntRect rect;
+        };
+
+        /*!
+         * \brief Adds a group of images to the atlas.
+         * \details Must be called before pack().
+         * \returns The index of the first image of the group.
+         */
+        unsigned int add(std::vector<sf::Image> images);
+
+        /*!
+         * \brief Packs the images in the images of the pages.
+         * \details Doesn't use the graphics context. The regions are known once it returns.
+         */
+        void pack();
+
+        /*!
+         * \brief Creates the textures of the pages packed by pack().
+         * \details The images are freed once they are in the pages. If pack() hasn't been called, or if the graphics card doesn't support pages as large as the packed ones, the images are packed first. Must be called from the thread owning the graphics context.
+         */
+        void upload();
+
+        /*!
+         * \brief Packs the images and creates the pages, see pack() and upload().
+         */
+        void build() {
+            pack();
+            upload();
+        }
+
+        /*!
+         * \brief Removes all the images and the pages.
+         */
+        void clear();
+
+        Region const &getRegion(unsigned int index) const {
+            return regions[index];
+        }
+        sf::Texture const &getPage(unsigned int page) const {
+            return *pages[page];
+        }
+        unsigned int getPageCount() const { return pages.size(); }
+
+      private:
+        /*!
+         * \brief Empty pixels left around each image, so that the neighbour images never bleed in when the view is scaled.
+         */
+        static constexpr unsigned int PADDING = 1;
+
+        /*!
+         * \brief Packs the images in pages of at most `maxSize` pixels of side.
+         */
+        void pack(unsigned int maxSize);
+
+        std::vector<sf::Image> images;
+        /*!
+         * \brief The index of the first image of each group, and its number of images.
+         */
+        std::vector<std::pair<unsigned int, unsigned int>> groups;
+        std::vector<Region> regions;
+        /*!
+         * \brief The images of the pages, between pack() and upload().
+         */
+        std::vector<sf::Image> pageImages;
+        /*!
+         * \brief The maximal size of a page given to pack().
+         */
+        unsigned int packedSize = 0;
+        /*!
+         * \brief The pages. Stored by pointer, so that their addresses stay valid for the code drawing them.
+         */
+        std::vector<std::unique_ptr<sf::Texture>> pages;
+    };
+
+} // namespace Utils
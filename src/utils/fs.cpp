@@ -11,9 +11,14 @@ File under GNU GPL v3.0
 #include <string>
 
 #ifndef _WIN32
+#    include <fcntl.h>
 #    include <sys/stat.h>
+#    include <unistd.h>
 #else
 #    include <direct.h>
+#    include <fcntl.h>
+#    include <io.h>
+#    include <windows.h>
 #endif
 
 namespace Utils {
@@ -35,5 +40,76 @@ namespace Utils {
             return false;
         }
 
+        bool replaceFile(const std::string &path, const void *data,
+                         std::size_t size) {
+            std::string temporary = path + ".tmp";
+            const char *bytes = static_cast<const char *>(data);
+#ifndef _WIN32
+            int file =
+                ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if(file < 0) {
+                return false;
+            }
+            bool written = true;
+            while(size > 0) {
+                ssize_t count = ::write(file, bytes, size);
+                if(count < 0) {
+                    if(errno == EINTR) {
+                        continue;
+                    }
+                    written = false;
+                    break;
+                }
+                bytes += count;
+                size -= count;
+            }
+            // The content must be on the disk before the rename makes it
+            // the file, else a power loss can leave an empty file.
+            written = written && ::fsync(file) == 0;
+            written = ::close(file) == 0 && written;
+            if(!written || ::rename(temporary.c_str(), path.c_str()) != 0) {
+                ::unlink(temporary.c_str());
+                return false;
+            }
+            // Makes the rename itself durable
+            std::string::size_type slash = path.find_last_of('/');
+            std::string directory =
+                slash == std::string::npos ? "." : path.substr(0, slash + 1);
+            int directoryFile = ::open(directory.c_str(), O_RDONLY);
+            if(directoryFile < 0) {
+                return false;
+            }
+            bool synced = ::fsync(directoryFile) == 0;
+            return ::close(directoryFile) == 0 && synced;
+#else
+            int file = ::_open(temporary.c_str(),
+                               _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY,
+                               _S_IREAD | _S_IWRITE);
+            if(file < 0) {
+                return false;
+            }
+            bool written = true;
+            while(size > 0 && written) {
+                unsigned int chunk =
+                    size > (1u << 30) ? (1u << 30) : (unsigned int)size;
+                int count = ::_write(file, bytes, chunk);
+                written = count > 0;
+                bytes += count;
+                size -= written ? count : 0;
+            }
+            written = written && ::_commit(file) == 0;
+            written = ::_close(file) == 0 && written;
+            // MOVEFILE_WRITE_THROUGH only returns once the rename is on
+            // the disk
+            if(!written || !MoveFileExA(temporary.c_str(), path.c_str(),
+                                        MOVEFILE_REPLACE_EXISTING |
+                                            MOVEFILE_WRITE_THROUGH)) {
+                ::_unlink(temporary.c_str());
+                return false;
+            }
+            return true;
+#endif
+        }
+
     } // namespace Fs
 } // namespace Utils
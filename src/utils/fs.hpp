@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace Utils {
@@ -23,5 +24,15 @@ namespace Utils {
          */
         bool mkdir(const std::string &path);
 
+        /*!
+         * \brief Replaces the content of a file, without ever leaving it incomplete.
+         * \details The data is first written in the file `path` + ".tmp", which is flushed to the disk, then renamed over `path`, and the directory is flushed too. If the program or the system crashes meanwhile, the file contains either its previous content or the new one.
+         *
+         * \param path file path in the UNIX format
+         * \return `true` if the file has been replaced; `false` in case of error, in which case the previous file is left untouched.
+         */
+        bool replaceFile(const std::string &path, const void *data,
+                         std::size_t size);
+
     } // namespace Fs
 } // namespace Utils
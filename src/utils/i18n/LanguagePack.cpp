@@ -0,0 +1,133 @@
+/*
+LanguagePack.cpp
+Author : Cyrielle
+File under GNU GPL v3.0 license
+*/
+#include "LanguagePack.hpp"
+
+#include <SFML/System/Utf.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "../exceptions.hpp"
+#include "../log.hpp"
+
+namespace Utils {
+    namespace I18n {
+
+        namespace {
+            /*!
+             * \brief Reads a line of the language file, as UTF-8 bytes.
+             * \returns `false` if the end of the file has been reached.
+             */
+            bool readLine(std::ifstream &input, std::string &line) {
+                line.clear();
+                for(unsigned int i = 0; i < 1024; i++) {
+                    int got = input.get();
+                    if(got == std::char_traits<char>::eof()) {
+                        return !line.empty();
+                    }
+                    if(got == '\n' || got < 31) {
+                        break;
+                    }
+                    line += (char)got;
+                }
+                return true;
+            }
+        } // namespace
+
+        LanguagePack::LanguagePack(std::string const &file) {
+            std::ifstream keysFile(file, std::ios::binary);
+            Log::oplog("Keys initialization");
+            if(!keysFile) {
+                throw LoadingException(file, true);
+            }
+            static const std::string prefix = "key.";
+            std::unordered_map<std::string, Entry> interned;
+            std::string line;
+            // Keys recovering, until the ending line
+            while(readLine(keysFile, line) && line != "end") {
+                // Splits the line in two parts. The value stops at the next
+                // '=', if there is one.
+                std::size_t keyEnd = line.find('=');
+                std::string key = line.substr(0, keyEnd);
+                // Only the keys with the prefix can be requested
+                if(key.empty() || key.compare(0, prefix.size(), prefix) != 0) {
+                    continue;
+                }
+                std::string value = " ";
+                if(keyEnd != std::string::npos) {
+                    std::size_t valueSize = line.find('=', keyEnd + 1);
+                    if(valueSize != std::string::npos) {
+                        valueSize -= keyEnd + 1;
+                    }
+                    value = line.substr(keyEnd + 1, valueSize);
+                }
+                // If a key is duplicated, the first one is kept
+                if(index.emplace(key.substr(prefix.size()), entries.size())
+                       .second) {
+                    entries.push_back(intern(value, interned));
+                }
+            }
+            data.shrink_to_fit();
+            entries.shrink_to_fit();
+            slots.shrink_to_fit();
+            Log::oplog("Loaded " + std::to_string(entries.size()) + " keys (" +
+                       std::to_string(getMemorySize()) + " bytes)");
+        }
+
+        LanguagePack::Entry LanguagePack::intern(
+            std::string const &str,
+            std::unordered_map<std::string, Entry> &interned) {
+            auto found = interned.find(str);
+            if(found != interned.end()) {
+                return found->second;
+            }
+            Entry entry;
+            entry.offset = data.size();
+            entry.size = str.size();
+            entry.firstSlot = slots.size();
+            // '~' is a single byte in UTF-8 and never appears inside the
+            // encoding of another character.
+            for(std::uint32_t i = 0; i < str.size(); i++) {
+                if(str[i] == '~') {
+                    slots.push_back(i);
+                }
+            }
+            entry.slotCount = slots.size() - entry.firstSlot;
+            data += str;
+            interned.emplace(str, entry);
+            return entry;
+        }
+
+        int LanguagePack::getIndex(std::string const &key) const {
+            auto found = index.find(key);
+            return found != index.end() ? (int)found->second : -1;
+        }
+
+        StringTemplate LanguagePack::getTemplate(int index) const {
+            Entry const &entry = entries[index];
+            return StringTemplate(
+                std::string_view(data).substr(entry.offset, entry.size),
+                slots.data() + entry.firstSlot, entry.slotCount);
+        }
+
+        std::vector<sf::Uint32> LanguagePack::getCharacters() const {
+            std::vector<sf::Uint32> characters;
+            characters.reserve(data.size());
+            sf::Utf8::toUtf32(data.begin(), data.end(),
+                              std::back_inserter(characters));
+            std::sort(characters.begin(), characters.end());
+            characters.erase(std::unique(characters.begin(), characters.end()),
+                             characters.end());
+            return characters;
+        }
+
+        std::size_t LanguagePack::getMemorySize() const {
+            return data.capacity() + entries.capacity() * sizeof(Entry) +
+                   slots.capacity() * sizeof(std::uint32_t);
+        }
+
+    } // namespace I18n
+} // namespace Utils
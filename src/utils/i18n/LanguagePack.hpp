@@ -0,0 +1,97 @@
+/*!
+ * \file LanguagePack.hpp
+ * \author Cyrielle
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Config.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../StringTemplate.hpp"
+
+namespace Utils {
+    namespace I18n {
+
+        /*!
+         * \brief The strings of a language, compiled in a compact form.
+         * \details The strings of the language file are stored once each, in UTF-8, in a single block of memory. A table gives for each string its offset in the block and the positions of its placeholders, and a hash map gives the index of each key in the table.
+         *
+         * A pack is never modified after its creation, so it can be shared and kept in memory to switch back to the language instantly.
+         */
+        class LanguagePack {
+          public:
+            /*!
+             * \brief Compiles a language file (.rkeys format).
+             * \param file The path of the file.
+             * \throws LoadingException If the file can't be opened.
+             */
+            explicit LanguagePack(std::string const &file);
+
+            LanguagePack(LanguagePack const &) = delete;
+            LanguagePack &operator=(LanguagePack const &) = delete;
+
+            /*!
+             * \brief Returns the index of the given key, or -1 if the key doesn't exist.
+             * \param key The key, without its "key." prefix.
+             */
+            int getIndex(std::string const &key) const;
+
+            /*!
+             * \brief Returns the template of the string at the given index.
+             * \details The template refers to the memory of the pack, so it must not be used after the pack is destroyed.
+             */
+            StringTemplate getTemplate(int index) const;
+
+            /*!
+             * \brief Returns all the different characters used by the strings, sorted.
+             */
+            std::vector<sf::Uint32> getCharacters() const;
+
+            /*!
+             * \brief Returns the number of bytes used by the strings and the table.
+             */
+            std::size_t getMemorySize() const;
+
+          private:
+            /*!
+             * \brief An entry of the offset table.
+             */
+            struct Entry {
+                std::uint32_t offset;    /*!< \brief Offset of the string in LanguagePack::data. */
+                std::uint32_t size;      /*!< \brief Size in bytes of the string. */
+                std::uint32_t firstSlot; /*!< \brief Index of the first placeholder in LanguagePack::slots. */
+                std::uint32_t slotCount; /*!< \brief Number of placeholders in the string. */
+            };
+
+            /*!
+             * \brief All the strings, in UTF-8. A string used by several keys is stored once.
+             */
+            std::string data;
+            /*!
+             * \brief The offset table, in the order of the language file.
+             */
+            std::vector<Entry> entries;
+            /*!
+             * \brief The positions of the placeholders, in bytes from the beginning of their string.
+             */
+            std::vector<std::uint32_t> slots;
+            /*!
+             * \brief Associates each key, without its "key." prefix, with its index in the offset table.
+             */
+            std::unordered_map<std::string, std::uint32_t> index;
+
+            /*!
+             * \brief Adds a string to the pack, sharing its storage with an identical string if there is one.
+             * \param interned The entries already added, indexed by their string.
+             */
+            Entry intern(std::string const &str,
+                         std::unordered_map<std::string, Entry> &interned);
+        };
+
+    } // namespace I18n
+} // namespace Utils
@@ -6,12 +6,15 @@ File under GNU GPL v3.0
 */
 #include "Translator.hpp"
 
+#include <algorithm>
 #include <utility>
 
 #include "../ResourceLoader.hpp"
 #include "../StringKeys.hpp"
+#include "../TextLayout.hpp"
 #include "../log.hpp"
 #include "ATranslatable.hpp"
+#include "LanguagePack.hpp"
 
 namespace Utils {
     namespace I18n {
@@ -28,10 +31,18 @@ namespace Utils {
                           Desactivated : if we need to reload the keys
             */
 
-            stringkeys = StringKeys(Utils::ResourceLoader::getResourcePath() +
-                                    langMap[langCode]);
+            std::shared_ptr<const LanguagePack> &pack = packs[langCode];
+            if(pack == nullptr) {
+                pack = std::make_shared<const LanguagePack>(
+                    Utils::ResourceLoader::getResourcePath() +
+                    langMap[langCode]);
+            }
+            stringkeys.setPack(pack);
 
             _currentLang = langCode;
+            for(auto const &[font, sizes] : prewarmedFonts) {
+                prewarm(*font, sizes);
+            }
             for(auto &listener : _listeners) {
                 listener->onLangChanged();
             }
@@ -39,6 +50,36 @@ namespace Utils {
 
         const std::string &Translator::getLang() { return _currentLang; }
 
+        void Translator::addPrewarmedFont(
+            sf::Font const &font, std::vector<unsigned int> characterSizes) {
+            if(!_currentLang.empty()) {
+                prewarm(font, characterSizes);
+            }
+            prewarmedFonts.emplace_back(&font, std::move(characterSizes));
+        }
+
+        void Translator::removePrewarmedFont(sf::Font const &font) {
+            prewarmedFonts.erase(
+                std::remove_if(prewarmedFonts.begin(), prewarmedFonts.end(),
+                               [&font](auto const &pair) {
+                                   return pair.first == &font;
+                               }),
+                prewarmedFonts.end());
+        }
+
+        void Translator::prewarm(
+            sf::Font const &font,
+            std::vector<unsigned int> const &characterSizes) {
+            std::vector<sf::Uint32> characters = stringkeys.getCharacters();
+            for(unsigned int size : characterSizes) {
+                TextLayout::get(font, size).prewarm(characters);
+            }
+            Utils::Log::oplog("Prepared " + std::to_string(characters.size()) +
+                              " glyphs at " +
+                              std::to_string(characterSizes.size()) +
+                              " character sizes");
+        }
+
         const std::map<const std::string, const std::string>
         Translator::getAvailableLanguages() {
             return langMap;
@@ -62,6 +103,8 @@ namespace Utils {
         void Translator::setAvailableLanguages(
             std::map<const std::string, const std::string> langMap) {
             this->langMap = langMap;
+            // The files may have changed
+            packs.clear();
         }
     } // namespace I18n
 } // namespace Utils
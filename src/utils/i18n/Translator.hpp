@@ -6,15 +6,23 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "../StringKeys.hpp"
 
+namespace sf {
+    class Font;
+} // namespace sf
+
 namespace Utils {
     namespace I18n {
 
         class ATranslatable;
+        class LanguagePack;
 
         /*!
          * \brief Class in charge of the lang setting. It load (and reload) language file.
@@ -34,6 +42,7 @@ namespace Utils {
 
             /*!
              * \brief Sets the language.
+             * \details The language file is compiled into a LanguagePack the first time the language is set. The pack is then kept, so setting the language again only replaces the pack used by the StringKeys.
              * \warning It MUST be called at start to set the first language.
              *
              * \param lang_code should be one of the available languages.
@@ -65,6 +74,19 @@ namespace Utils {
 
             StringKeys &getStringKeys() { return stringkeys; }
 
+            /*!
+             * \brief Registers a font to prepare each time a language is set.
+             * \details All the glyphs needed by the strings of the language are loaded in the font at each given character size, so they are not rasterized during the game. If a language is already set, the font is prepared immediately.
+             * \param font The font. Must be unregistered with removePrewarmedFont before being destroyed.
+             * \param characterSizes The character sizes the font is used with.
+             */
+            void addPrewarmedFont(sf::Font const &font,
+                                  std::vector<unsigned int> characterSizes);
+            /*!
+             * \brief Unregisters a font registered with addPrewarmedFont.
+             */
+            void removePrewarmedFont(sf::Font const &font);
+
           private:
             Translator() = default;
 
@@ -74,6 +96,23 @@ namespace Utils {
             std::unordered_set<ATranslatable *> _listeners;
 
             StringKeys stringkeys;
+
+            /*!
+             * \brief The languages already loaded, indexed by language code.
+             */
+            std::map<std::string, std::shared_ptr<const LanguagePack>> packs;
+
+            /*!
+             * \brief The fonts to prepare when a language is set, with their character sizes.
+             */
+            std::vector<std::pair<const sf::Font *, std::vector<unsigned int>>>
+                prewarmedFonts;
+
+            /*!
+             * \brief Loads the glyphs used by the current language in a font.
+             */
+            void prewarm(sf::Font const &font,
+                         std::vector<unsigned int> const &characterSizes);
         };
 
     } // namespace I18n
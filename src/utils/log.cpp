@@ -6,50 +6,453 @@ File under GNU GPL v3.0
 */
 #include "./log.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "./fs.hpp"
 #include "./time.hpp"
 #include "exceptions.hpp"
 
-/**Principal log*/
-std::ostream *rlog = nullptr;
-/**Error log*/
-std::ostream *rerrLog = nullptr;
-
 namespace Utils {
     namespace Log {
 
+        namespace {
+            /*!
+             * \brief Number of records in the ring buffer. Must be a power of two.
+             */
+            constexpr std::size_t RECORD_COUNT = 1024;
+            constexpr std::size_t TAG_SIZE = 16;
+            constexpr std::size_t TEXT_SIZE = 480;
+
+            /*!
+             * \brief Number of different messages followed by the rate limiter.
+             */
+            constexpr std::size_t RATE_SLOTS = 64;
+            /*!
+             * \brief Number of copies of a message written per window.
+             */
+            constexpr unsigned int RATE_LIMIT = 5;
+            /*!
+             * \brief Duration of a rate limiting window, in milliseconds.
+             */
+            constexpr int RATE_WINDOW = 1000;
+
+            /*!
+             * \brief A message waiting to be written.
+             */
+            struct Record {
+                /*!
+                 * \brief Position of the record in the buffer, used to know if it can be written or read (see RingBuffer).
+                 */
+                std::atomic<std::size_t> sequence;
+                int time;
+                Level level;
+                /*!
+                 * \brief Number of copies of the message suppressed before this one.
+                 */
+                unsigned int repeated;
+                std::uint16_t tagLength;
+                std::uint16_t length;
+                char tag[TAG_SIZE];
+                char text[TEXT_SIZE];
+            };
+
+            /*!
+             * \brief A bounded lock-free queue with several writers and a single reader.
+             * \details Each record holds a sequence number: it equals the position of the record when the record is free, and the position plus one when the record is ready to be read.
+             */
+            class RingBuffer {
+              private:
+                Record records[RECORD_COUNT];
+                alignas(64) std::atomic<std::size_t> writePos{0};
+                alignas(64) std::atomic<std::size_t> readPos{0};
+
+              public:
+                RingBuffer() {
+                    for(std::size_t i = 0; i < RECORD_COUNT; i++) {
+                        records[i].sequence.store(i, std::memory_order_relaxed);
+                    }
+                }
+
+                /*!
+                 * \brief Reserves a record to write in.
+                 * \param pos Receives the position of the record, to give to publish().
+                 * \returns The record, or `nullptr` if the buffer is full.
+                 */
+                Record *acquire(std::size_t &pos) {
+                    pos = writePos.load(std::memory_order_relaxed);
+                    while(true) {
+                        Record &record = records[pos & (RECORD_COUNT - 1)];
+                        std::size_t sequence =
+                            record.sequence.load(std::memory_order_acquire);
+                        std::ptrdiff_t diff =
+                            (std::ptrdiff_t)sequence - (std::ptrdiff_t)pos;
+                        if(diff == 0) {
+                            if(writePos.compare_exchange_weak(
+                                   pos, pos + 1, std::memory_order_relaxed)) {
+                                return &record;
+                            }
+                        } else if(diff < 0) {
+                            return nullptr;
+                        } else {
+                            pos = writePos.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                /*!
+                 * \brief Makes a record acquired with acquire() readable.
+                 */
+                void publish(Record *record, std::size_t pos) {
+                    record->sequence.store(pos + 1, std::memory_order_release);
+                }
+
+                /*!
+                 * \brief Returns the next record to read, or `nullptr` if there is none.
+                 */
+                Record *front() {
+                    std::size_t pos = readPos.load(std::memory_order_relaxed);
+                    Record &record = records[pos & (RECORD_COUNT - 1)];
+                    if(record.sequence.load(std::memory_order_acquire) !=
+                       pos + 1) {
+                        return nullptr;
+                    }
+                    return &record;
+                }
+
+                /*!
+                 * \brief Frees the record returned by front().
+                 */
+                void pop() {
+                    std::size_t pos = readPos.load(std::memory_order_relaxed);
+                    records[pos & (RECORD_COUNT - 1)].sequence.store(
+                        pos + RECORD_COUNT, std::memory_order_release);
+                    readPos.store(pos + 1, std::memory_order_release);
+                }
+
+                std::size_t getWritePos() const {
+                    return writePos.load(std::memory_order_acquire);
+                }
+
+                std::size_t getReadPos() const {
+                    return readPos.load(std::memory_order_acquire);
+                }
+
+                bool isHalfFull() const {
+                    return getWritePos() - getReadPos() >= RECORD_COUNT / 2;
+                }
+            };
+
+            /*!
+             * \brief Counts the recent copies of a message.
+             * \details The fields are updated without lock, so the counts can be slightly off when several threads log the same message at the same time.
+             */
+            struct RateSlot {
+                std::atomic<std::uint64_t> hash{0};
+                std::atomic<int> windowStart{0};
+                std::atomic<unsigned int> count{0};
+                std::atomic<unsigned int> suppressed{0};
+            };
+
+            struct Logger {
+                /*! \brief Principal log */
+                std::ostream *log = nullptr;
+                /*! \brief Error log */
+                std::ostream *errLog = nullptr;
+
+                RingBuffer buffer;
+                RateSlot rateSlots[RATE_SLOTS];
+
+                std::atomic<Level> level{Level::INFO};
+                /*!
+                 * \brief Number of messages dropped because the buffer was full.
+                 */
+                std::atomic<unsigned int> dropped{0};
+                /*!
+                 * \brief Number of suppressed copies whose message has been replaced in the rate limiter before being written again.
+                 */
+                std::atomic<unsigned int> lostRepeats{0};
+
+                std::atomic<bool> running{false};
+                std::thread writer;
+                /*!
+                 * \brief Held while the buffer is read, since the buffer only supports one reader at a time.
+                 */
+                std::mutex drainMutex;
+                std::mutex wakeMutex;
+                std::condition_variable wake;
+            };
+
+            Logger &getLogger() {
+                static Logger logger;
+                return logger;
+            }
+
+            std::uint64_t hashMessage(Level level, std::string_view tag,
+                                      std::string_view text) {
+                // FNV-1a
+                std::uint64_t hash = 14695981039346656037ull ^ (int)level;
+                for(std::string_view part : {tag, text}) {
+                    for(char c : part) {
+                        hash = (hash ^ (unsigned char)c) * 1099511628211ull;
+                    }
+                    hash = (hash ^ 0xff) * 1099511628211ull;
+                }
+                return hash;
+            }
+
+            /*!
+             * \brief Decides if a message can be written.
+             * \param repeated Receives the number of copies of the message suppressed since the last copy written.
+             * \returns `false` if the message has been written too many times recently.
+             */
+            bool allow(Logger &logger, std::uint64_t hash, int now,
+                       unsigned int &repeated) {
+                RateSlot &slot = logger.rateSlots[hash % RATE_SLOTS];
+                repeated = 0;
+                if(slot.hash.load(std::memory_order_relaxed) != hash) {
+                    slot.hash.store(hash, std::memory_order_relaxed);
+                    slot.windowStart.store(now, std::memory_order_relaxed);
+                    slot.count.store(1, std::memory_order_relaxed);
+                    logger.lostRepeats.fetch_add(slot.suppressed.exchange(0),
+                                                 std::memory_order_relaxed);
+                    return true;
+                }
+                if(now - slot.windowStart.load(std::memory_order_relaxed) >=
+                   RATE_WINDOW) {
+                    slot.windowStart.store(now, std::memory_order_relaxed);
+                    slot.count.store(1, std::memory_order_relaxed);
+                    repeated = slot.suppressed.exchange(0);
+                    return true;
+                }
+                if(slot.count.fetch_add(1, std::memory_order_relaxed) <
+                   RATE_LIMIT) {
+                    return true;
+                }
+                slot.suppressed.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            void write(Logger &logger, Record const &record) {
+                std::ostream &stream =
+                    record.level == Level::CRITICAL ? *logger.errLog : *logger.log;
+                stream << "[T = " << record.time << "] - ";
+                if(record.level == Level::WARN) {
+                    stream << "[WARN] ";
+                } else if(record.level == Level::VERBOSE) {
+                    stream << "[VERBOSE] ";
+                }
+                if(record.tagLength != 0) {
+                    stream << '[';
+                    stream.write(record.tag, record.tagLength);
+                    stream << "] ";
+                }
+                stream.write(record.text, record.length);
+                if(record.repeated != 0) {
+                    stream << " (" << record.repeated
+                           << " similar messages suppressed)";
+                }
+                stream << '\n';
+            }
+
+            /*!
+             * \brief Writes all the readable records. Must be called with Logger::drainMutex locked.
+             */
+            void drainLocked(Logger &logger) {
+                bool written = false;
+                while(Record *record = logger.buffer.front()) {
+                    write(logger, *record);
+                    logger.buffer.pop();
+                    written = true;
+                }
+                unsigned int dropped = logger.dropped.exchange(0);
+                if(dropped != 0) {
+                    *logger.errLog << "[T = " << Time::getElapsedMilliseconds()
+                                   << "] - [log] " << dropped
+                                   << " messages dropped, the buffer was full"
+                                   << '\n';
+                    written = true;
+                }
+                unsigned int lost = logger.lostRepeats.exchange(0);
+                if(lost != 0) {
+                    *logger.log << "[T = " << Time::getElapsedMilliseconds()
+                                << "] - [log] " << lost
+                                << " repeated messages suppressed" << '\n';
+                    written = true;
+                }
+                if(written) {
+                    logger.log->flush();
+                    logger.errLog->flush();
+                }
+            }
+
+            void drain(Logger &logger) {
+                std::lock_guard<std::mutex> lock(logger.drainMutex);
+                drainLocked(logger);
+            }
+
+            void writerLoop() {
+                Logger &logger = getLogger();
+                while(logger.running.load()) {
+                    drain(logger);
+                    std::unique_lock<std::mutex> lock(logger.wakeMutex);
+                    logger.wake.wait_for(lock, std::chrono::milliseconds(50));
+                }
+                drain(logger);
+            }
+
+            /*!
+             * \brief Writes the buffer while the program is crashing.
+             * \details The writing thread may be the one crashing, so the lock isn't waited for indefinitely.
+             */
+            void crashFlush() {
+                Logger &logger = getLogger();
+                if(logger.log == nullptr) {
+                    return;
+                }
+                for(unsigned int attempt = 0; attempt < 100; attempt++) {
+                    if(logger.drainMutex.try_lock()) {
+                        drainLocked(logger);
+                        logger.drainMutex.unlock();
+                        return;
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+
+            std::terminate_handler previousTerminate = nullptr;
+
+            void onTerminate() {
+                crashFlush();
+                if(previousTerminate != nullptr) {
+                    previousTerminate();
+                }
+                std::abort();
+            }
+
+            void onSignal(int signal) {
+                crashFlush();
+                std::signal(signal, SIG_DFL);
+                std::raise(signal);
+            }
+        } // namespace
+
         void init(std::string path) {
-            if(rlog != nullptr)
+            Logger &logger = getLogger();
+            if(logger.log != nullptr)
                 return; // Log already initialized
 
             Fs::mkdir(path);
 
-            rlog = new std::ofstream(std::string(path + "log.txt"));
-            rerrLog = new std::ofstream(std::string(path + "errLog.txt"));
+            logger.log = new std::ofstream(std::string(path + "log.txt"));
+            logger.errLog = new std::ofstream(std::string(path + "errLog.txt"));
 
-            if(!*rlog) {
-                rlog = &std::cout;
+            if(!*logger.log) {
+                logger.log = &std::cout;
                 std::cerr << "Unable to open the log." << std::endl;
             }
-            if(!*rerrLog) {
-                rerrLog = &std::cerr;
+            if(!*logger.errLog) {
+                logger.errLog = &std::cerr;
                 std::cerr << "Unable to open the error log." << std::endl;
             }
+
+            logger.running = true;
+            logger.writer = std::thread(writerLoop);
+
+            std::atexit(shutdown);
+            previousTerminate = std::set_terminate(onTerminate);
+            for(int signal : {SIGSEGV, SIGABRT, SIGFPE, SIGILL}) {
+                std::signal(signal, onSignal);
+            }
         }
 
-        void oplog(const std::string &toSay, bool error) {
-            if(rlog == nullptr || rerrLog == nullptr) {
+        void shutdown() {
+            Logger &logger = getLogger();
+            if(!logger.running.exchange(false)) {
+                return;
+            }
+            logger.wake.notify_one();
+            logger.writer.join();
+        }
+
+        void flush() {
+            Logger &logger = getLogger();
+            if(!logger.running.load()) {
+                if(logger.log != nullptr) {
+                    drain(logger);
+                }
+                return;
+            }
+            std::size_t target = logger.buffer.getWritePos();
+            while(logger.buffer.getReadPos() < target) {
+                logger.wake.notify_one();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        void setLevel(Level level) { getLogger().level = level; }
+
+        bool isEnabled(Level level) { return level >= getLogger().level; }
+
+        void log(Level level, std::string_view tag, std::string_view toSay) {
+            Logger &logger = getLogger();
+            if(logger.log == nullptr || logger.errLog == nullptr) {
                 throw NullptrException("log stream or error log stream", false);
             }
-            std::ostream *logStream = error ? rerrLog : rlog;
-            *logStream << "[T = " << Time::getElapsedMilliseconds() << "] - "
-                       << toSay << std::endl;
+            if(level < logger.level) {
+                return;
+            }
+            int now = Time::getElapsedMilliseconds();
+            unsigned int repeated = 0;
+            if(!allow(logger, hashMessage(level, tag, toSay), now, repeated)) {
+                return;
+            }
+
+            std::size_t pos = 0;
+            Record *record = logger.buffer.acquire(pos);
+            if(record == nullptr) {
+                logger.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            record->time = now;
+            record->level = level;
+            record->repeated = repeated;
+            record->tagLength = std::min(tag.size(), TAG_SIZE - 1);
+            std::memcpy(record->tag, tag.data(), record->tagLength);
+            if(toSay.size() > TEXT_SIZE) {
+                record->length = TEXT_SIZE;
+                std::memcpy(record->text, toSay.data(), TEXT_SIZE - 3);
+                std::memcpy(record->text + TEXT_SIZE - 3, "...", 3);
+            } else {
+                record->length = toSay.size();
+                std::memcpy(record->text, toSay.data(), toSay.size());
+            }
+            logger.buffer.publish(record, pos);
+
+            if(!logger.running.load(std::memory_order_relaxed)) {
+                // After shutdown(), the messages are written directly.
+                drain(logger);
+            } else if(level == Level::CRITICAL || logger.buffer.isHalfFull()) {
+                logger.wake.notify_one();
+            }
+        }
+
+        void oplog(const std::string &toSay, bool error) {
+            log(error ? Level::CRITICAL : Level::INFO, "", toSay);
         }
 
-        void warn(const std::string &toSay) { oplog("[WARN] " + toSay); }
+        void warn(const std::string &toSay) { log(Level::WARN, "", toSay); }
 
     } // namespace Log
 } // namespace Utils
@@ -8,21 +8,64 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 
 namespace Utils {
     /*!
      * \namespace Utils::Log
      * \brief Contains log-related utilities.
+     * \details The messages are not written by the calling thread: they are copied in a fixed-size ring buffer, and a background thread writes them to the log files, flushing them once per batch. Logging never blocks: if the buffer is full, the message is dropped and the number of dropped messages is written to the log later.
+     *
+     * A message repeated too often is only written a few times per second; the number of suppressed copies is written with the next copy allowed.
+     *
+     * The buffer is written to the files when the program ends, calls std::terminate or receives a fatal signal.
      * \todo Make it a class.
      */
     namespace Log {
         /*!
-         * \brief Initialize the log streams.
+         * \brief The importance of a message.
+         * \details The names avoid `DEBUG` and `ERROR`, which are defined as macros on some platforms.
+         */
+        enum class Level { VERBOSE, INFO, WARN, CRITICAL };
+
+        /*!
+         * \brief Initialize the log streams and starts the writing thread.
          *
          * This function must be called before any call to oplog().
          */
         void init(std::string path);
 
+        /*!
+         * \brief Writes the remaining messages and stops the writing thread.
+         * \details Called automatically at the end of the program. Messages logged afterwards are written directly.
+         */
+        void shutdown();
+
+        /*!
+         * \brief Waits until all the messages logged before the call are written to the files.
+         */
+        void flush();
+
+        /*!
+         * \brief Sets the minimum level of the messages written. The default level is Level::INFO.
+         */
+        void setLevel(Level level);
+
+        /*!
+         * \brief Returns `true` if a message of the given level would be written.
+         * \details Allows to skip building messages that would be ignored.
+         */
+        bool isEnabled(Level level);
+
+        /*!
+         * \brief Write a log message in a log file.
+         *
+         * \param level The importance of the message. Messages of level Level::CRITICAL are written in the error log file, the others in the regular log file.
+         * \param tag The subsystem logging the message. Only its 15 first characters are kept.
+         * \param toSay message to write. Messages longer than 480 bytes are truncated.
+         */
+        void log(Level level, std::string_view tag, std::string_view toSay);
+
         /*!
          * \brief Write a log message in a log file.
          *
@@ -31,7 +74,7 @@ namespace Utils {
          */
         void oplog(const std::string &toSay, bool error = false);
 
-        /*! \brief Add "[WARN - " to the parameter before calling oplog.
+        /*! \brief Write a log message of level Level::WARN in the regular log file.
          *
          * \param toSay message to write.
          */
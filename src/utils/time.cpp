@@ -14,10 +14,18 @@ File under GNU GPL v3.0
  */
 static sf::Clock ticks;
 
+/**
+ * Time elapsed in the game, advanced by the game loop.
+ */
+static int gameTime = 0;
+
 namespace Utils {
     namespace Time {
 
-        void initClock() { ticks.restart(); }
+        void initClock() {
+            ticks.restart();
+            gameTime = 0;
+        }
 
         int getElapsedMilliseconds() {
             return ticks.getElapsedTime().asMilliseconds();
@@ -25,6 +33,10 @@ namespace Utils {
 
         float getElapsedSeconds() { return ticks.getElapsedTime().asSeconds(); }
 
+        int getGameMilliseconds() { return gameTime; }
+
+        void advanceGameTime(int duration) { gameTime += duration; }
+
         void wait(int duration) { sf::sleep(sf::milliseconds(duration)); }
 
     } // namespace Time
@@ -32,6 +32,18 @@ namespace Utils {
          */
         float getElapsedSeconds();
 
+        /*!
+         *  \return The number of milliseconds elapsed in the game.
+         *  \details Unlike getElapsedMilliseconds(), the game time stops while the game is paused and goes faster when the game is fast-forwarded. The animations of the game must use it.
+         */
+        int getGameMilliseconds();
+
+        /*!
+         *  \brief Advances the game time. Called by the game loop before each update of the game.
+         *  \param duration The duration of the update, in milliseconds.
+         */
+        void advanceGameTime(int duration);
+
         /*!
          *   \brief Pauses the program for a determined duration.
          *   \param duration Time to wait, in milliseconds